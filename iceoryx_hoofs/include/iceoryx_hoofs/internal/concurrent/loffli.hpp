@@ -89,6 +89,18 @@ class LoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Pop multiple values from the free-list with a single compare-and-swap on the head
+    /// @param [out] indices array with a capacity of at least maxNumberOfIndices which is filled with the popped indices
+    /// @param [in] maxNumberOfIndices is the maximum number of indices to pop
+    /// @return the number of popped indices, which is less than maxNumberOfIndices if the free-list runs empty
+    uint32_t popBatch(cxx::not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept;
+
+    /// Push multiple previously popped elements with a single compare-and-swap on the head
+    /// @param [in] indices array with the previously popped indices
+    /// @param [in] numberOfIndices is the number of indices in the array
+    /// @return the number of pushed indices; invalid or already pushed indices are skipped and not counted
+    uint32_t pushBatch(cxx::not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
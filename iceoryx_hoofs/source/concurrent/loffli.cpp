@@ -104,5 +104,93 @@ bool LoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+uint32_t LoFFLi::popBatch(cxx::not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept
+{
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfIndices{0U};
+
+    do
+    {
+        // the chain is traversed optimistically; if any other thread modifies the free-list in the meantime, the
+        // abaCounter of the head changes and the traversal is repeated
+        numberOfIndices = 0U;
+        Index_t nextIndex = oldHead.indexToNextFreeIndex;
+        while (numberOfIndices < maxNumberOfIndices && nextIndex < m_size)
+        {
+            indices[numberOfIndices] = nextIndex;
+            ++numberOfIndices;
+            nextIndex = m_nextFreeIndex[nextIndex];
+        }
+
+        if (numberOfIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.indexToNextFreeIndex = nextIndex;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    /// see pop for the synchronization of m_nextFreeIndex
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        m_nextFreeIndex[indices[i]] = m_invalidIndex;
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfIndices;
+}
+
+uint32_t LoFFLi::pushBatch(cxx::not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept
+{
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_release);
+
+    /// the valid indices are linked to a chain which is not yet visible to other threads; m_size is used as
+    /// temporary end marker which also ensures that an index which occurs twice in the array is pushed only once
+    Index_t first{m_invalidIndex};
+    Index_t last{m_invalidIndex};
+    uint32_t numberOfPushedIndices{0U};
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        const Index_t index = indices[i];
+        if (index >= m_size || m_nextFreeIndex[index] != m_invalidIndex)
+        {
+            continue;
+        }
+
+        m_nextFreeIndex[index] = m_size;
+        if (numberOfPushedIndices == 0U)
+        {
+            first = index;
+        }
+        else
+        {
+            m_nextFreeIndex[last] = index;
+        }
+        last = index;
+        ++numberOfPushedIndices;
+    }
+
+    if (numberOfPushedIndices == 0U)
+    {
+        return 0U;
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        m_nextFreeIndex[last] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = first;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return numberOfPushedIndices;
+}
+
 } // namespace concurrent
 } // namespace iox
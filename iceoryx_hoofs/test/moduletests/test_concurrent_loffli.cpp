@@ -199,4 +199,68 @@ TYPED_TEST(LoFFLi_test, PushToUninitializedLoFFLi)
     decltype(this->m_loffli) loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+TYPED_TEST(LoFFLi_test, PopBatchReturnsAllIndicesInOrder)
+{
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size), Eq(Size));
+    for (uint32_t i = 0; i < Size; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PopBatchWithMoreRequestedThanAvailableReturnsRemainingIndices)
+{
+    uint32_t index;
+    ASSERT_THAT(this->m_loffli.pop(index), Eq(true));
+
+    uint32_t indices[Size + 2];
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size + 2), Eq(Size - 1));
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size + 2), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PopBatchFromUninitializedLoFFLi)
+{
+    uint32_t indices[Size];
+    decltype(this->m_loffli) loFFLi;
+    EXPECT_THAT(loFFLi.popBatch(indices, Size), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchMakesIndicesAvailableAgain)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popBatch(indices, Size), Eq(Size));
+
+    EXPECT_THAT(this->m_loffli.pushBatch(indices, Size), Eq(Size));
+
+    std::vector<uint32_t> useListPoped;
+    uint32_t index;
+    while (this->m_loffli.pop(index))
+    {
+        useListPoped.push_back(index);
+    }
+    std::sort(useListPoped.begin(), useListPoped.end());
+    EXPECT_THAT(useListPoped, ElementsAre(0U, 1U, 2U, 3U));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchSkipsInvalidAndDuplicateIndices)
+{
+    uint32_t index;
+    ASSERT_THAT(this->m_loffli.pop(index), Eq(true));
+
+    uint32_t indices[] = {index, index, index + 1, Size + 42};
+    EXPECT_THAT(this->m_loffli.pushBatch(indices, 4U), Eq(1U));
+    EXPECT_THAT(this->m_loffli.push(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchToUninitializedLoFFLi)
+{
+    uint32_t indices[] = {0U, 1U};
+    decltype(this->m_loffli) loFFLi;
+    EXPECT_THAT(loFFLi.pushBatch(indices, 2U), Eq(0U));
+}
 } // namespace
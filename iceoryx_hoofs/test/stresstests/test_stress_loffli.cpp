@@ -0,0 +1,209 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
+
+#include "iceoryx_hoofs/testing/test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+
+constexpr int64_t STRESS_TIME_HOURS{0};
+constexpr int64_t STRESS_TIME_MINUTES{0};
+constexpr int64_t STRESS_TIME_SECONDS{2};
+constexpr std::chrono::milliseconds STRESS_TIME{
+    ((STRESS_TIME_HOURS * 60 + STRESS_TIME_MINUTES) * 60 + STRESS_TIME_SECONDS) * 1000};
+
+class LoFFLiStress : public Test
+{
+  public:
+    using Index_t = iox::concurrent::LoFFLi::Index_t;
+
+    static constexpr uint32_t CAPACITY{1024U};
+    static constexpr uint32_t MAX_BATCH_SIZE{16U};
+    static constexpr uint32_t MAX_INDICES_PER_THREAD{64U};
+    static constexpr uint32_t NOT_OWNED{0U};
+
+    void SetUp() override
+    {
+        m_loffli.init(m_freeIndicesMemory.data(), CAPACITY);
+        for (auto& owner : m_owner)
+        {
+            owner.store(NOT_OWNED);
+        }
+    }
+
+    /// @brief marks the index as owned by the thread; fails if another thread already owns it, i.e. the index was
+    /// handed out twice
+    void acquireOwnership(const Index_t index, const uint32_t threadId)
+    {
+        uint32_t expected{NOT_OWNED};
+        if (index >= CAPACITY || !m_owner[index].compare_exchange_strong(expected, threadId))
+        {
+            m_numberOfErrors.fetch_add(1U);
+        }
+    }
+
+    void releaseOwnership(const Index_t index, const uint32_t threadId)
+    {
+        uint32_t expected{threadId};
+        if (!m_owner[index].compare_exchange_strong(expected, NOT_OWNED))
+        {
+            m_numberOfErrors.fetch_add(1U);
+        }
+    }
+
+    /// @brief acquires and releases indices alternating with single and batch operations, the thread holds up to
+    /// MAX_INDICES_PER_THREAD indices at the same time to keep the free-list in a changing state
+    void work(const uint32_t threadId, const bool useBatch)
+    {
+        std::mt19937 generator(threadId);
+        std::uniform_int_distribution<uint32_t> batchSize(1U, MAX_BATCH_SIZE);
+        std::vector<Index_t> ownedIndices;
+        ownedIndices.reserve(MAX_INDICES_PER_THREAD + MAX_BATCH_SIZE);
+        Index_t batch[MAX_BATCH_SIZE];
+
+        while (!m_stop.load(std::memory_order_relaxed))
+        {
+            if (ownedIndices.size() < MAX_INDICES_PER_THREAD)
+            {
+                if (useBatch)
+                {
+                    const auto numberOfIndices = m_loffli.popBatch(batch, batchSize(generator));
+                    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+                    {
+                        acquireOwnership(batch[i], threadId);
+                        ownedIndices.push_back(batch[i]);
+                    }
+                }
+                else
+                {
+                    Index_t index{0U};
+                    if (m_loffli.pop(index))
+                    {
+                        acquireOwnership(index, threadId);
+                        ownedIndices.push_back(index);
+                    }
+                }
+            }
+
+            if (ownedIndices.empty() || (ownedIndices.size() < MAX_INDICES_PER_THREAD && generator() % 2U == 0U))
+            {
+                continue;
+            }
+
+            // the batch threads also return single indices and the single threads also return batches, this way
+            // the order of the free-list is mixed by both operations
+            const uint32_t numberOfIndicesToPush =
+                (useBatch == (generator() % 4U == 0U))
+                    ? 1U
+                    : std::min(batchSize(generator), static_cast<uint32_t>(ownedIndices.size()));
+            for (uint32_t i = 0U; i < numberOfIndicesToPush; ++i)
+            {
+                batch[i] = ownedIndices.back();
+                ownedIndices.pop_back();
+                releaseOwnership(batch[i], threadId);
+            }
+
+            if (numberOfIndicesToPush == 1U)
+            {
+                if (!m_loffli.push(batch[0U]))
+                {
+                    m_numberOfErrors.fetch_add(1U);
+                }
+            }
+            else if (m_loffli.pushBatch(batch, numberOfIndicesToPush) != numberOfIndicesToPush)
+            {
+                m_numberOfErrors.fetch_add(1U);
+            }
+            m_numberOfOperations.fetch_add(1U, std::memory_order_relaxed);
+        }
+
+        for (auto index : ownedIndices)
+        {
+            releaseOwnership(index, threadId);
+            if (!m_loffli.push(index))
+            {
+                m_numberOfErrors.fetch_add(1U);
+            }
+        }
+    }
+
+    std::vector<Index_t> m_freeIndicesMemory = std::vector<Index_t>(
+        (iox::concurrent::LoFFLi::requiredIndexMemorySize(CAPACITY) + sizeof(Index_t) - 1U) / sizeof(Index_t));
+    iox::concurrent::LoFFLi m_loffli;
+    std::atomic<uint32_t> m_owner[CAPACITY];
+    std::atomic<bool> m_stop{false};
+    std::atomic<uint64_t> m_numberOfErrors{0U};
+    std::atomic<uint64_t> m_numberOfOperations{0U};
+};
+
+constexpr uint32_t LoFFLiStress::CAPACITY;
+constexpr uint32_t LoFFLiStress::MAX_BATCH_SIZE;
+constexpr uint32_t LoFFLiStress::MAX_INDICES_PER_THREAD;
+constexpr uint32_t LoFFLiStress::NOT_OWNED;
+
+/// @brief Multiple threads pop and push indices concurrently, half of them with popBatch/pushBatch and the other half
+/// with pop/push. No index must be handed out twice and after all threads returned their indices, every index must be
+/// in the free-list exactly once.
+TEST_F(LoFFLiStress, InterleavedBatchAndSingleOperationsNeitherLoseNorDuplicateIndices)
+{
+    const uint32_t numberOfThreads = std::max(4U, std::thread::hardware_concurrency());
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < numberOfThreads; ++i)
+    {
+        const uint32_t threadId = i + 1U;
+        const bool useBatch = (i % 2U == 0U);
+        threads.emplace_back([this, threadId, useBatch] { work(threadId, useBatch); });
+    }
+
+    std::this_thread::sleep_for(STRESS_TIME);
+    m_stop = true;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(m_numberOfErrors.load(), Eq(0U));
+
+    std::vector<bool> isPopped(CAPACITY, false);
+    uint32_t numberOfPoppedIndices{0U};
+    Index_t index{0U};
+    while (m_loffli.pop(index))
+    {
+        ASSERT_THAT(index, Lt(CAPACITY));
+        EXPECT_FALSE(isPopped[index]) << "index " << index << " is duplicated";
+        isPopped[index] = true;
+        ++numberOfPoppedIndices;
+    }
+    EXPECT_THAT(numberOfPoppedIndices, Eq(CAPACITY)) << "indices were lost";
+
+    std::cout << "push operations: " << m_numberOfOperations.load() << std::endl;
+    EXPECT_THAT(m_numberOfOperations.load(), Gt(0U));
+}
+
+int main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -69,6 +69,32 @@ class MemPool
 
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Acquires multiple chunks at once with a single operation on the free list
+    /// @param[out] indices array with a capacity of at least maxNumberOfIndices which is filled with the chunk indices
+    /// @param[in] maxNumberOfIndices is the maximum number of chunks to acquire
+    /// @return the number of acquired chunks, which can be less than maxNumberOfIndices if the mempool runs empty
+    /// @note the acquired chunks are accounted as used chunks, regardless of whether they are cached or in use
+    uint32_t getChunkIndices(freeList_t::Index_t* const indices, const uint32_t maxNumberOfIndices) noexcept;
+
+    /// @brief Returns multiple chunks at once with a single operation on the free list
+    /// @param[in] indices array with the indices of the chunks to return
+    /// @param[in] numberOfIndices is the number of indices in the array
+    void freeChunkIndices(const freeList_t::Index_t* const indices, const uint32_t numberOfIndices) noexcept;
+
+    /// @brief Converts a chunk index acquired with getChunkIndices to the corresponding chunk
+    /// @param[in] index of the chunk
+    /// @return pointer to the chunk
+    void* indexToChunk(const freeList_t::Index_t index) const noexcept;
+
+    /// @brief Asks every MemPoolCache which holds chunks of this MemPool to return them with its next acquisition.
+    /// This is done automatically when a chunk is requested from an exhausted MemPool.
+    void requestCacheFlush() noexcept;
+
+    /// @brief Returns the number of cache flush requests; a MemPoolCache returns its chunks when this number changed
+    /// since its last refill
+    /// @return number of cache flush requests
+    uint32_t getCacheFlushRequestCount() const noexcept;
+
   private:
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
@@ -84,6 +110,7 @@ class MemPool
     std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
     /// @todo: end
+    std::atomic<uint32_t> m_cacheFlushRequestCount{0U};
 
     freeList_t m_freeIndices;
 };
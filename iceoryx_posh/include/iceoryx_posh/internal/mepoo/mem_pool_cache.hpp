@@ -0,0 +1,102 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_MEM_POOL_CACHE_HPP
+#define IOX_POSH_MEPOO_MEM_POOL_CACHE_HPP
+
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief The MemPoolCache is a small magazine of chunk indices in front of a MemPool. It claims chunks from the
+/// MemPool in batches, which reduces the contention on the shared free list when many ports acquire chunks from the
+/// same MemPool concurrently. The batch size is limited to a fraction of the free chunks of the MemPool, this way the
+/// caches cannot drain a MemPool which runs low on chunks. When the MemPool is exhausted nevertheless, it requests
+/// a cache flush and every cache returns its surplus chunks with its next acquisition. The MemPoolCache is bound to the MemPool it was last refilled from and must be
+/// flushed before it can be used with another MemPool.
+/// @note The MemPoolCache is not thread-safe and intended to be placed in the shared memory next to the port which
+/// uses it. This enables RouDi to return the cached chunks to the MemPool when the owning process terminates.
+/// Cached chunks are accounted as used chunks by the MemPool since they are not available for other ports.
+/// Only the acquisition is batched, released chunks are returned directly to the MemPool since they can be released
+/// by any process which holds a reference to them.
+class MemPoolCache
+{
+  public:
+    static constexpr uint32_t CAPACITY{8U};
+    /// the batch size is at most the number of free chunks of the MemPool divided by this value
+    static constexpr uint32_t MEMPOOL_TO_BATCH_SIZE_RATIO{8U};
+
+    MemPoolCache() noexcept = default;
+    MemPoolCache(const MemPoolCache&) = delete;
+    MemPoolCache(MemPoolCache&&) = delete;
+    MemPoolCache& operator=(const MemPoolCache&) = delete;
+    MemPoolCache& operator=(MemPoolCache&&) = delete;
+    ~MemPoolCache() noexcept = default;
+
+    /// @brief Acquires a chunk from the cache and refills the cache with a batch of chunks from the MemPool if
+    /// it is empty. If the cache holds chunks of another MemPool, these are returned before the refill. If the
+    /// MemPool requested a cache flush since the last refill or the cache holds more than maxBatchSize chunks, all
+    /// cached chunks except the acquired one are returned.
+    /// @param[in] memPool from which the chunk shall be acquired
+    /// @param[in] maxBatchSize is the maximum number of chunks acquired by a refill, including the returned one
+    /// @return pointer to the chunk or nullptr if the MemPool has no more chunks
+    void* getChunk(MemPool& memPool, const uint32_t maxBatchSize = CAPACITY) noexcept;
+
+    /// @brief Returns all cached chunks to the MemPool they were acquired from
+    void flush() noexcept;
+
+    /// @brief Returns the number of currently cached chunks
+    uint32_t size() const noexcept;
+
+  private:
+    rp::RelativePointer<MemPool> m_memPool;
+    uint32_t m_size{0U};
+    uint32_t m_cacheFlushRequestCount{0U};
+    MemPool::freeList_t::Index_t m_indices[CAPACITY];
+};
+
+/// @brief Bundles the caches required by MemoryManager::getChunk, one for the chunk memory of each MemPool and one
+/// for the chunk management
+struct ChunkCache
+{
+    /// @brief Acquires the memory for a chunk from the cache of the MemPool
+    /// @param[in] memPoolIndex is the index of the MemPool in the MemoryManager
+    /// @param[in] memPool from which the chunk shall be acquired
+    /// @return pointer to the chunk or nullptr if the MemPool has no more chunks
+    void* getChunkMemory(const uint32_t memPoolIndex, MemPool& memPool) noexcept;
+
+    /// @brief Acquires the memory for a chunk management. The cache holds never more chunk managements than chunk
+    /// memory, this way the chunk management pool cannot run empty while there are free chunks in the MemPools.
+    /// @param[in] chunkManagementPool from which the chunk management shall be acquired
+    /// @return pointer to the chunk management or nullptr if the chunk management pool has no more chunks
+    void* getChunkManagement(MemPool& chunkManagementPool) noexcept;
+
+    /// @brief Returns all cached chunks to their MemPools
+    void flush() noexcept;
+
+    MemPoolCache m_chunkMemoryCaches[MAX_NUMBER_OF_MEMPOOLS];
+    MemPoolCache m_chunkManagementCache;
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_MEM_POOL_CACHE_HPP
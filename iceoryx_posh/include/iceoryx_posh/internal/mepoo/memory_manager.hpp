@@ -21,8 +21,10 @@
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool_cache.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
 #include <cstdint>
 #include <limits>
@@ -39,8 +41,6 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxChunkPayloadSize_t = cxx::range<uint32_t, 1, std::numeric_limits<uint32_t>::max() - sizeof(ChunkHeader)>;
@@ -59,6 +59,13 @@ class MemoryManager
 
     SharedChunk getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Acquires a chunk like getChunk but claims the chunk memory and the chunk management in batches via
+    /// the provided cache to reduce the contention on the free lists of the mempools
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] chunkCache which is used to acquire the chunk; must not be used concurrently
+    /// @return a SharedChunk which is a nullptr if no chunk could be acquired
+    SharedChunk getChunk(const ChunkSettings& chunkSettings, ChunkCache& chunkCache) noexcept;
+
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
@@ -76,10 +83,33 @@ class MemoryManager
                     const cxx::greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
                     const cxx::greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
     void generateChunkManagementPool(posix::Allocator& managementAllocator) noexcept;
+    SharedChunk getChunkFromMemPool(const ChunkSettings& chunkSettings, ChunkCache* const chunkCache) noexcept;
+    void* acquireChunk(const uint32_t memPoolIndex, ChunkCache* const chunkCache) noexcept;
+    /// @brief Takes exactly one chunk from the mempool without reporting an empty mempool; used when running out of
+    /// chunks is expected, like with the USE_NEXT_LARGER_MEMPOOL policy
+    static void* acquireSingleChunkQuietly(MemPool& memPool) noexcept;
+
+    /// @brief Every power of two is divided into SUB_CLASSES_PER_POWER_OF_TWO size classes of equal width; every size
+    /// class maps to the first mempool which can hold the smallest size of that size class. This turns the search for
+    /// a fitting mempool into a constant time lookup, followed by skipping the mempools whose chunk sizes are within
+    /// the same size class, which is at most 1/16 of a power of two wide.
+    static uint32_t sizeClass(const uint32_t size) noexcept;
+    static uint64_t smallestSizeOfSizeClass(const uint32_t sizeClass) noexcept;
+    static uint32_t floorLog2(const uint32_t value) noexcept;
+    void generateSizeClassIndex() noexcept;
+    uint32_t findMemPoolIndex(const uint32_t requiredChunkSize) const noexcept;
 
   private:
+    static constexpr uint32_t SUB_CLASS_BITS{4U};
+    static constexpr uint32_t SUB_CLASSES_PER_POWER_OF_TWO{1U << SUB_CLASS_BITS};
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{32U * SUB_CLASSES_PER_POWER_OF_TWO};
+    static_assert(MAX_NUMBER_OF_MEMPOOLS <= std::numeric_limits<uint8_t>::max(),
+                  "The mempool index must fit into the size class index");
+
     bool m_denyAddMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
+    MemPoolExhaustedPolicy m_memPoolExhaustedPolicy{MemPoolExhaustedPolicy::RETURN_ERROR};
+    uint8_t m_sizeClassToMemPoolIndex[NUMBER_OF_SIZE_CLASSES]{};
 
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     cxx::vector<MemPool, 1> m_chunkManagementPool;
@@ -17,7 +17,9 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
@@ -47,15 +49,19 @@ enum class ChunkDistributorError
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
 /// When different threads operate on it (e.g. application sends chunks and RouDi adds and removes queues),
 /// a locking policy must be used that ensures consistent data in the ChunkDistributorData.
-/// @todo There are currently some challenge:
-/// For the stored queues and the history, containers are used which are not thread safe. Therefore we use an
-/// inter-process mutex. But this can lead to deadlocks if a user process gets terminated while one of its
-/// threads is in the ChunkDistributor and holds a lock. An easier setup would be if changing the queues
-/// by a middleware thread and sending chunks by the user process would not interleave. I.e. there is no concurrent
-/// access to the containers. Then a memory synchronization would be sufficient.
-/// The cleanup() call is the biggest challenge. This is used to free chunks that are still held by a not properly
-/// terminated user application. Even if access from middleware and user threads do not overlap, the history
-/// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
+/// The LockingPolicy is only acquired by the modifying side (adding and removing queues, cleanup). The sending side
+/// works without a lock on a snapshot of the stored queues which is never modified while a sender is registered for
+/// it. Modifications are done on a copy which is activated afterwards. The history is guarded by a spin lock which is
+/// held only for adding a chunk to the history or for copying chunks out of it, never while delivering chunks.
+/// The sender registers for the queue container and adds the chunk to the history in one step under the history lock.
+/// A new queue is activated under the same lock together with taking the history snapshot, therefore every chunk is
+/// either part of the snapshot or delivered by the sender, which delivers to the new queue only after the snapshot was
+/// delivered. This way no chunk is lost or duplicated, independent of the history capacity.
+/// The modifying side waits as long as a sender is registered for a queue container and never discards the state of
+/// a sender on its own. If a sending application terminates while it is in the ChunkDistributor, its reader
+/// registrations and the spin lock are discarded by cleanup(), which RouDi calls when it removes the ports of the
+/// terminated application.
+/// @todo The history container could still be inconsistent if the application was terminated while changing it.
 /// We would need a container like the UsedChunkList to have one that is robust against such inconsistencies....
 /// A perfect job for our future selves
 template <typename ChunkDistributorDataType>
@@ -123,7 +129,9 @@ class ChunkDistributor
     /// @brief Clears the chunk history
     void clearHistory() noexcept;
 
-    /// @brief cleanup the used shrared memory chunks
+    /// @brief cleanup the used shrared memory chunks and discard the state a terminated sender left behind
+    /// @note must only be called when the sender does not use the ChunkDistributor anymore; it does not acquire the
+    /// LockingPolicy since a modification could wait for the terminated sender
     void cleanup() noexcept;
 
   protected:
@@ -131,6 +139,45 @@ class ChunkDistributor
     MemberType_t* getMembers() noexcept;
 
   private:
+    using HistoryChunks_t =
+        cxx::vector<mepoo::SharedChunk, ChunkDistributorDataType::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
+
+    using HistoryLockOwner = typename MemberType_t::HistoryLockOwner;
+
+    void addToHistoryWithoutLocking(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief copies the last chunks of the history, must only be called with the history lock acquired
+    void copyHistoryWithoutLocking(const uint64_t numberOfChunks, HistoryChunks_t& chunks) noexcept;
+
+    /// @brief waits until the modifier delivered the history to the queue which is added right now
+    void waitForPendingHistory(const ChunkQueueData_t* const queue) const noexcept;
+
+    /// @brief registers the caller as reader of the currently active queue container which is then not modified
+    /// until releaseQueues is called
+    /// @return the index of the registered queue container
+    uint32_t acquireActiveQueues() const noexcept;
+    void releaseQueues(const uint32_t queuesIndex) const noexcept;
+
+    /// @brief applies the modifier to a copy of the active queue container, must only be called with the
+    /// LockingPolicy acquired
+    /// @return the index of the modified copy which is not active yet
+    template <typename Modifier>
+    uint32_t prepareQueues(const Modifier& modifier) noexcept;
+
+    /// @brief applies the modifier to a copy of the active queue container, activates the copy and waits until no
+    /// sender uses the previous container anymore, must only be called with the LockingPolicy acquired
+    template <typename Modifier>
+    void updateQueues(const Modifier& modifier) noexcept;
+
+    /// @brief waits until no sender is registered for the queue container anymore
+    void waitForReaders(const uint32_t queuesIndex) const noexcept;
+
+    /// @brief discards the reader registrations and the history lock of a terminated sender
+    void discardSenderState() noexcept;
+
+    void lockHistory(const HistoryLockOwner owner) const noexcept;
+    void unlockHistory() const noexcept;
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
 
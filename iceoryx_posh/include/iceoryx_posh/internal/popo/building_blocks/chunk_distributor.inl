@@ -49,36 +49,49 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    // only the modifiers which hold the lock change the active queue container, therefore no reader registration is
+    // required here
+    const auto& activeQueues = getMembers()->m_queues[getMembers()->m_activeQueuesIndex.load()];
     const auto alreadyKnownReceiver =
-        std::find_if(getMembers()->m_queues.begin(),
-                     getMembers()->m_queues.end(),
-                     [&](const ChunkQueueData_t* const queue) { return queue == queueToAdd; });
+        std::find_if(activeQueues.begin(), activeQueues.end(), [&](const ChunkQueueData_t* const queue) {
+            return queue == queueToAdd;
+        });
 
     // check if the queue is not already in the list
-    if (alreadyKnownReceiver == getMembers()->m_queues.end())
+    if (alreadyKnownReceiver == activeQueues.end())
     {
-        if (getMembers()->m_queues.size() < getMembers()->m_queues.capacity())
+        if (activeQueues.size() < activeQueues.capacity())
         {
-            // PRQA S 3804 1 # we checked the capacity, so pushing will be fine
-            getMembers()->m_queues.push_back(rp::RelativePointer<ChunkQueueData_t>(queueToAdd));
-
-            const auto currChunkHistorySize = getMembers()->m_history.size();
-
             if (requestedHistory > getMembers()->m_historyCapacity)
             {
                 LogWarn() << "Chunk history request exceeds history capacity! Request is " << requestedHistory
                           << ". Capacity is " << getMembers()->m_historyCapacity << ".";
             }
 
-            // if the current history is large enough we send the requested number of chunks, else we send the
-            // total history
-            const auto startIndex =
-                (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
-            for (auto i = startIndex; i < currChunkHistorySize; ++i)
+            const auto queuesIndex = prepareQueues([&](typename MemberType_t::QueueContainer_t& queues) {
+                // PRQA S 3804 1 # we checked the capacity, so pushing will be fine
+                queues.push_back(rp::RelativePointer<ChunkQueueData_t>(queueToAdd));
+            });
+
+            // the queue is activated together with taking the history snapshot. Senders register for the queues
+            // under the same lock, therefore a chunk is either part of the snapshot or sent by a sender which knows
+            // the new queue and waits with the delivery to it until the snapshot is delivered
+            HistoryChunks_t historyChunks;
+            lockHistory(HistoryLockOwner::MODIFIER);
+            copyHistoryWithoutLocking(requestedHistory, historyChunks);
+            getMembers()->m_queueWithPendingHistory = queueToAdd;
+            getMembers()->m_activeQueuesIndex.store(queuesIndex);
+            unlockHistory();
+
+            for (auto& chunk : historyChunks)
             {
-                deliverToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
+                deliverToQueue(queueToAdd, chunk);
             }
 
+            lockHistory(HistoryLockOwner::MODIFIER);
+            getMembers()->m_queueWithPendingHistory = nullptr;
+            unlockHistory();
+
             return cxx::success<void>();
         }
         else
@@ -100,11 +113,13 @@ inline cxx::expected<ChunkDistributorError> ChunkDistributor<ChunkDistributorDat
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    const auto iter = std::find(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), queueToRemove);
-    if (iter != getMembers()->m_queues.end())
+    const auto& activeQueues = getMembers()->m_queues[getMembers()->m_activeQueuesIndex.load()];
+    if (std::find(activeQueues.begin(), activeQueues.end(), queueToRemove) != activeQueues.end())
     {
-        // PRQA S 3804 1 # we don't use iter any longer so return value can be ignored
-        getMembers()->m_queues.erase(iter);
+        updateQueues([&](typename MemberType_t::QueueContainer_t& queues) {
+            // PRQA S 3804 1 # we don't use the iterator any longer so return value can be ignored
+            queues.erase(std::find(queues.begin(), queues.end(), queueToRemove));
+        });
 
         return cxx::success<void>();
     }
@@ -119,29 +134,40 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    getMembers()->m_queues.clear();
+    updateQueues([](typename MemberType_t::QueueContainer_t& queues) { queues.clear(); });
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    const auto queuesIndex = acquireActiveQueues();
+    const bool hasQueues = !getMembers()->m_queues[queuesIndex].empty();
+    releaseQueues(queuesIndex);
 
-    return !getMembers()->m_queues.empty();
+    return hasQueues;
 }
 
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
+    // the queues must be acquired together with adding the chunk to the history, see tryAddQueue
+    lockHistory(HistoryLockOwner::SENDER);
+    auto queuesIndex = acquireActiveQueues();
+    addToHistoryWithoutLocking(chunk);
+    const ChunkQueueData_t* const queueWithPendingHistory = getMembers()->m_queueWithPendingHistory.get();
+    unlockHistory();
+
     typename ChunkDistributorDataType::QueueContainer_t remainingQueues;
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-
         bool willWaitForSubscriber =
             getMembers()->m_subscriberTooSlowPolicy == SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER;
-        // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
-        {
+        // send to all the queues; the queue which is added right now is served last since its history has to be
+        // delivered first
+        const auto& queues = getMembers()->m_queues[queuesIndex];
+        const bool hasQueueWithPendingHistory =
+            (queueWithPendingHistory != nullptr)
+            && (std::find(queues.begin(), queues.end(), queueWithPendingHistory) != queues.end());
+        const auto deliver = [&](const rp::RelativePointer<ChunkQueueData_t>& queue) {
             bool isBlockingQueue =
                 (willWaitForSubscriber && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PUBLISHER);
 
@@ -156,7 +182,20 @@ inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues
                     ChunkQueuePusher_t(queue.get()).lostAChunk();
                 }
             }
+        };
+        for (auto& queue : queues)
+        {
+            if (queue.get() != queueWithPendingHistory)
+            {
+                deliver(queue);
+            }
         }
+        if (hasQueueWithPendingHistory)
+        {
+            waitForPendingHistory(queueWithPendingHistory);
+            deliver(*std::find(queues.begin(), queues.end(), queueWithPendingHistory));
+        }
+        releaseQueues(queuesIndex);
     }
 
     // busy waiting until every queue is served
@@ -164,40 +203,23 @@ inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues
     {
         std::this_thread::yield();
         {
-            // create intersection of current queues and remainingQueues
+            // remove the queues which are no longer part of the current queue set
             // reason: it is possible that since the last iteration some subscriber have already unsubscribed
             //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
-            typename ChunkDistributorDataType::QueueContainer_t queueIntersection(remainingQueues.size());
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end());
-            std::sort(remainingQueues.begin(), remainingQueues.end());
-
-            auto iter = std::set_intersection(getMembers()->m_queues.begin(),
-                                              getMembers()->m_queues.end(),
-                                              remainingQueues.begin(),
-                                              remainingQueues.end(),
-                                              queueIntersection.begin());
-            queueIntersection.resize(static_cast<uint64_t>(iter - queueIntersection.begin()));
-            remainingQueues = queueIntersection;
-
-            // deliver to remaining queues
-            for (uint64_t i = remainingQueues.size() - 1U; !remainingQueues.empty(); --i)
+            queuesIndex = acquireActiveQueues();
+            const auto& currentQueues = getMembers()->m_queues[queuesIndex];
+            for (uint64_t i = remainingQueues.size(); i > 0U; --i)
             {
-                if (deliverToQueue(remainingQueues[i].get(), chunk))
+                const auto& queue = remainingQueues[i - 1U];
+                if (std::find(currentQueues.begin(), currentQueues.end(), queue) == currentQueues.end()
+                    || deliverToQueue(queue.get(), chunk))
                 {
-                    remainingQueues.erase(remainingQueues.begin() + i);
-                }
-
-                // don't move this up since the for loop counts downwards and the algorithm would break
-                if (i == 0U)
-                {
-                    break;
+                    remainingQueues.erase(remainingQueues.begin() + (i - 1U));
                 }
             }
+            releaseQueues(queuesIndex);
         }
     }
-
-    addToHistoryWithoutDelivery(chunk);
 }
 
 template <typename ChunkDistributorDataType>
@@ -210,8 +232,14 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(cxx::not_
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    lockHistory(HistoryLockOwner::SENDER);
+    addToHistoryWithoutLocking(chunk);
+    unlockHistory();
+}
 
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutLocking(mepoo::SharedChunk chunk) noexcept
+{
     if (0u < getMembers()->m_historyCapacity)
     {
         if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
@@ -226,12 +254,44 @@ inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDeliv
     }
 }
 
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::copyHistoryWithoutLocking(const uint64_t numberOfChunks,
+                                                                                  HistoryChunks_t& chunks) noexcept
+{
+    auto& history = getMembers()->m_history;
+    const uint64_t numberOfChunksToCopy = algorithm::min(numberOfChunks, static_cast<uint64_t>(history.size()));
+    for (auto i = history.size() - numberOfChunksToCopy; i < history.size(); ++i)
+    {
+        // PRQA S 3804 1 # chunks has the capacity of the history, so pushing will be fine
+        chunks.emplace_back(history[i].cloneToSharedChunk());
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::waitForPendingHistory(const ChunkQueueData_t* const queue) const noexcept
+{
+    while (true)
+    {
+        lockHistory(HistoryLockOwner::SENDER);
+        const bool isHistoryPending = (getMembers()->m_queueWithPendingHistory.get() == queue);
+        unlockHistory();
+        if (!isHistoryPending)
+        {
+            return;
+        }
+        std::this_thread::yield();
+    }
+}
+
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistorySize() noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    lockHistory(HistoryLockOwner::SENDER);
+    const auto historySize = getMembers()->m_history.size();
+    unlockHistory();
 
-    return getMembers()->m_history.size();
+    return historySize;
 }
 
 template <typename ChunkDistributorDataType>
@@ -243,36 +303,117 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistoryCapacity()
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
-
+    lockHistory(HistoryLockOwner::MODIFIER);
     for (auto& unmanagedChunk : getMembers()->m_history)
     {
         unmanagedChunk.releaseToSharedChunk();
     }
 
     getMembers()->m_history.clear();
+    unlockHistory();
 }
 
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
 {
-    if (getMembers()->tryLock())
+    // the sending side never acquires the LockingPolicy, therefore a terminated sender cannot leave it locked. The
+    // history lock and the reader registrations of a terminated sender are discarded since the sender will not access
+    // the ChunkDistributor anymore; a modification which waits for the terminated sender continues afterwards
+    discardSenderState();
+    clearHistory();
+}
+
+template <typename ChunkDistributorDataType>
+inline uint32_t ChunkDistributor<ChunkDistributorDataType>::acquireActiveQueues() const noexcept
+{
+    while (true)
     {
-        clearHistory();
-        getMembers()->unlock();
+        const auto queuesIndex = getMembers()->m_activeQueuesIndex.load();
+        getMembers()->m_queuesReaderCount[queuesIndex].fetch_add(1U);
+        // a modifier could have activated the other container and started to modify this one before the registration
+        // became visible; re-check to ensure the registered container is still the active one
+        if (queuesIndex == getMembers()->m_activeQueuesIndex.load())
+        {
+            return queuesIndex;
+        }
+        getMembers()->m_queuesReaderCount[queuesIndex].fetch_sub(1U);
     }
-    else
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::releaseQueues(const uint32_t queuesIndex) const noexcept
+{
+    getMembers()->m_queuesReaderCount[queuesIndex].fetch_sub(1U);
+}
+
+template <typename ChunkDistributorDataType>
+template <typename Modifier>
+inline uint32_t ChunkDistributor<ChunkDistributorDataType>::prepareQueues(const Modifier& modifier) noexcept
+{
+    const auto activeIndex = getMembers()->m_activeQueuesIndex.load();
+    const auto inactiveIndex = (activeIndex + 1U) % MemberType_t::NUMBER_OF_QUEUE_CONTAINERS;
+
+    // wait until the senders which still deliver with the previous queue set are finished
+    waitForReaders(inactiveIndex);
+
+    getMembers()->m_queues[inactiveIndex] = getMembers()->m_queues[activeIndex];
+    modifier(getMembers()->m_queues[inactiveIndex]);
+
+    return inactiveIndex;
+}
+
+template <typename ChunkDistributorDataType>
+template <typename Modifier>
+inline void ChunkDistributor<ChunkDistributorDataType>::updateQueues(const Modifier& modifier) noexcept
+{
+    const auto queuesIndex = prepareQueues(modifier);
+    getMembers()->m_activeQueuesIndex.store(queuesIndex);
+
+    // a removed queue must not be accessed anymore when the modification is finished
+    waitForReaders((queuesIndex + 1U) % MemberType_t::NUMBER_OF_QUEUE_CONTAINERS);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::waitForReaders(const uint32_t queuesIndex) const noexcept
+{
+    // a sender which is only slow must not be discarded, therefore there is no timeout; the registrations of a
+    // terminated sender are discarded by cleanup()
+    while (getMembers()->m_queuesReaderCount[queuesIndex].load() != 0U)
+    {
+        std::this_thread::yield();
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::discardSenderState() noexcept
+{
+    for (auto& readerCount : getMembers()->m_queuesReaderCount)
+    {
+        readerCount.store(0U);
+    }
+    // only a lock of the sender is discarded, the modifier could hold the lock while delivering the history
+    auto owner = HistoryLockOwner::SENDER;
+    getMembers()->m_historyLockOwner.compare_exchange_strong(owner, HistoryLockOwner::NONE, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::lockHistory(const HistoryLockOwner owner) const noexcept
+{
+    auto expected = HistoryLockOwner::NONE;
+    while (!getMembers()->m_historyLockOwner.compare_exchange_weak(
+        expected, owner, std::memory_order_acquire, std::memory_order_relaxed))
     {
-        /// @todo currently we have a deadlock / mutex destroy vulnerability if the ThreadSafePolicy is used
-        /// and a sending application dies when having the lock for sending. If the RouDi daemon wants to
-        /// cleanup or does discovery changes we have a deadlock or an exception when destroying the mutex
-        /// As long as we don't have a multi-threaded lock-free ChunkDistributor or another concept we die here
-        errorHandler(Error::kPOPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION,
-                     nullptr,
-                     ErrorLevel::FATAL);
+        expected = HistoryLockOwner::NONE;
+        std::this_thread::yield();
     }
 }
 
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::unlockHistory() const noexcept
+{
+    getMembers()->m_historyLockOwner.store(HistoryLockOwner::NONE, std::memory_order_release);
+}
+
 } // namespace popo
 } // namespace iox
 
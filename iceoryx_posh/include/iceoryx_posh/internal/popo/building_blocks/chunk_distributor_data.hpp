@@ -28,6 +28,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 
@@ -50,15 +51,35 @@ struct ChunkDistributorData : public LockingPolicy
 
     using QueueContainer_t =
         cxx::vector<rp::RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
-    QueueContainer_t m_queues;
+    static constexpr uint32_t NUMBER_OF_QUEUE_CONTAINERS{2U};
 
-    /// @todo If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
+    /// The queues are double buffered. The sender iterates the active container without any lock while
+    /// modifications are done on a copy in the inactive container, which is activated afterwards.
+    /// A container is only modified when no sender is registered as reader of it anymore.
+    QueueContainer_t m_queues[NUMBER_OF_QUEUE_CONTAINERS];
+    std::atomic<uint32_t> m_activeQueuesIndex{0U};
+    mutable std::atomic<uint64_t> m_queuesReaderCount[NUMBER_OF_QUEUE_CONTAINERS]{};
+
+    /// @todo If we would make the history lock-free, can we than extend the UsedChunkList to
     /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
     /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
     /// crash.
     using HistoryContainer_t =
         cxx::vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
+    /// the history is guarded by a spin lock which knows whether the sender or the modifier owns it instead of the
+    /// LockingPolicy, a lock which is left behind by a terminated sender can be discarded while an inter-process
+    /// mutex cannot
+    enum class HistoryLockOwner : uint32_t
+    {
+        NONE,
+        SENDER,
+        MODIFIER
+    };
+    mutable std::atomic<HistoryLockOwner> m_historyLockOwner{HistoryLockOwner::NONE};
+    /// queue which gets its history while the sender is already running, the sender delivers to this queue only
+    /// after the history was delivered; guarded by the history lock
+    rp::RelativePointer<ChunkQueueData_t> m_queueWithPendingHistory;
     const SubscriberTooSlowPolicy m_subscriberTooSlowPolicy;
 };
 
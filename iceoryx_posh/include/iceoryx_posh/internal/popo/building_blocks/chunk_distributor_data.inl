@@ -30,6 +30,10 @@ constexpr T min(const T left, const T right)
     return (left < right) ? left : right;
 }
 
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+constexpr uint32_t
+    ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::NUMBER_OF_QUEUE_CONTAINERS;
+
 template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
 inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::ChunkDistributorData(
     const SubscriberTooSlowPolicy policy, const uint64_t historyCapacity) noexcept
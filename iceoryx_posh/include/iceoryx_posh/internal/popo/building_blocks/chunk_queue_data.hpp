@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer_data.hpp"
 #include "iceoryx_hoofs/posix_wrapper/semaphore.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
@@ -43,8 +44,15 @@ struct ChunkQueueData : public LockingPolicy
     cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
     std::atomic_bool m_queueHasLostChunks{false};
 
-    rp::RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
-    cxx::optional<uint64_t> m_conditionVariableNotificationIndex;
+    /// @brief The condition variable and the notification index are read by the pusher without taking the lock.
+    /// They are guarded by a sequence number which is odd while the popper changes them; a pusher which observes an
+    /// odd or changed sequence number races with the attachment and does not notify, just like a push which got the
+    /// lock before the attachment. A pusher which read them right before the condition variable was unset can still
+    /// notify it, this results at most in a spurious notification since the ConditionVariableData is only reclaimed
+    /// by RouDi after its owner released it.
+    std::atomic<uint64_t> m_conditionVariableSequenceNumber{0U};
+    std::atomic<rp::RelativePointerData> m_conditionVariableDataPtr{rp::RelativePointerData()};
+    std::atomic<uint64_t> m_conditionVariableNotificationIndex{0U};
     const QueueFullPolicy m_queueFullPolicy;
 };
 
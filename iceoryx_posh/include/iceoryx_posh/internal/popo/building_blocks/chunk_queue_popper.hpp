@@ -97,6 +97,9 @@ class ChunkQueuePopper
     MemberType_t* getMembers() noexcept;
 
   private:
+    void publishConditionVariable(const rp::RelativePointerData conditionVariableData,
+                                  const uint64_t notificationIndex) noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
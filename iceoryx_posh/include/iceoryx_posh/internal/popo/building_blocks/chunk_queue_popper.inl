@@ -129,8 +129,15 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::setConditionVariable(Condition
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    getMembers()->m_conditionVariableDataPtr = &conditionVariableDataRef;
-    getMembers()->m_conditionVariableNotificationIndex.emplace(notificationIndex);
+    rp::RelativePointer<ConditionVariableData> conditionVariableDataPtr(&conditionVariableDataRef);
+    const auto id = conditionVariableDataPtr.getId();
+    const auto offset = conditionVariableDataPtr.getOffset();
+    cxx::Ensures(id <= rp::RelativePointerData::ID_RANGE && "RelativePointer id must fit into id type!");
+    cxx::Ensures(offset <= rp::RelativePointerData::OFFSET_RANGE
+                 && "RelativePointer offset must fit into offset type!");
+
+    publishConditionVariable(rp::RelativePointerData(static_cast<rp::RelativePointerData::id_t>(id), offset),
+                             notificationIndex);
 }
 
 template <typename ChunkQueueDataType>
@@ -138,14 +145,28 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::unsetConditionVariable() noexc
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    getMembers()->m_conditionVariableDataPtr = nullptr;
-    getMembers()->m_conditionVariableNotificationIndex.reset();
+    publishConditionVariable(rp::RelativePointerData(), 0U);
 }
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::isConditionVariableSet() const noexcept
 {
-    return getMembers()->m_conditionVariableDataPtr;
+    return !getMembers()->m_conditionVariableDataPtr.load(std::memory_order_relaxed).isLogicalNullptr();
+}
+
+template <typename ChunkQueueDataType>
+inline void
+ChunkQueuePopper<ChunkQueueDataType>::publishConditionVariable(const rp::RelativePointerData conditionVariableData,
+                                                               const uint64_t notificationIndex) noexcept
+{
+    auto& sequenceNumber = getMembers()->m_conditionVariableSequenceNumber;
+    const auto startSequenceNumber = sequenceNumber.load(std::memory_order_relaxed);
+
+    sequenceNumber.store(startSequenceNumber + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    getMembers()->m_conditionVariableDataPtr.store(conditionVariableData, std::memory_order_relaxed);
+    getMembers()->m_conditionVariableNotificationIndex.store(notificationIndex, std::memory_order_relaxed);
+    sequenceNumber.store(startSequenceNumber + 2U, std::memory_order_release);
 }
 
 } // namespace popo
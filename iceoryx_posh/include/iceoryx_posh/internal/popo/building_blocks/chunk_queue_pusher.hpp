@@ -58,6 +58,8 @@ class ChunkQueuePusher
     MemberType_t* getMembers() noexcept;
 
   private:
+    void notifyConditionVariable() noexcept;
+
     MemberType_t* m_chunkQueueDataPtr{nullptr};
 };
 
@@ -57,15 +57,7 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
-    {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
-        {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
-                .notify();
-        }
-    }
+    notifyConditionVariable();
 
     return !hasQueueOverflow;
 }
@@ -76,6 +68,31 @@ inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
     getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
 }
 
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notifyConditionVariable() noexcept
+{
+    const auto& sequenceNumber = getMembers()->m_conditionVariableSequenceNumber;
+    const auto startSequenceNumber = sequenceNumber.load(std::memory_order_acquire);
+    if (startSequenceNumber % 2U != 0U)
+    {
+        // the condition variable is attached or detached concurrently, this push happened before the attachment
+        return;
+    }
+
+    const auto conditionVariableData = getMembers()->m_conditionVariableDataPtr.load(std::memory_order_relaxed);
+    const auto notificationIndex = getMembers()->m_conditionVariableNotificationIndex.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequenceNumber.load(std::memory_order_relaxed) != startSequenceNumber
+        || conditionVariableData.isLogicalNullptr())
+    {
+        return;
+    }
+
+    rp::RelativePointer<ConditionVariableData> conditionVariableDataPtr(conditionVariableData.offset(),
+                                                                        conditionVariableData.id());
+    ConditionNotifier(*conditionVariableDataPtr.get(), notificationIndex).notify();
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -94,7 +94,7 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
 
     /// @brief Release all the chunks that are currently held. Caution: Only call this if the user process is no more
     /// running E.g. This cleans up chunks that were held by a user process that died unexpectetly, for avoiding lost
-    /// chunks in the system
+    /// chunks in the system. Chunks which are cached for later allocations are returned to the mempools.
     void releaseAll() noexcept;
 
   private:
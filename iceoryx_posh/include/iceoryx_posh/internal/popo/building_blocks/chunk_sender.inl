@@ -85,7 +85,9 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if process gets hard terminated in between
         // get a new chunk
-        mepoo::SharedChunk chunk = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        mepoo::SharedChunk chunk = getMembers()->m_useChunkCache
+                                       ? getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkCache)
+                                       : getMembers()->m_memoryMgr->getChunk(chunkSettings);
 
         if (chunk)
         {
@@ -170,6 +172,7 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    getMembers()->m_chunkCache.flush();
 }
 
 template <typename ChunkSenderDataType>
@@ -35,7 +35,8 @@ struct ChunkSenderData : public ChunkDistributorDataType
     explicit ChunkSenderData(cxx::not_null<mepoo::MemoryManager* const> memoryManager,
                              const SubscriberTooSlowPolicy subscriberTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const bool useChunkCache = false) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
 
@@ -44,6 +45,11 @@ struct ChunkSenderData : public ChunkDistributorDataType
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    const bool m_useChunkCache{false};
+    /// The cache is part of every sender, regardless of m_useChunkCache, since the port data is placed in the
+    /// shared memory management segment with a fixed layout. This costs one MemPoolCache per MemPool plus one for the
+    /// chunk management, i.e. about 1.8 KiB per publisher, client and server with MAX_NUMBER_OF_MEMPOOLS = 32.
+    mepoo::ChunkCache m_chunkCache;
 };
 
 } // namespace popo
@@ -26,10 +26,12 @@ inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataTyp
     cxx::not_null<mepoo::MemoryManager* const> memoryManager,
     const SubscriberTooSlowPolicy subscriberTooSlowPolicy,
     const uint64_t historyCapacity,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
+    const mepoo::MemoryInfo& memoryInfo,
+    const bool useChunkCache) noexcept
     : ChunkDistributorDataType(subscriberTooSlowPolicy, historyCapacity)
     , m_memoryMgr(memoryManager)
     , m_memoryInfo(memoryInfo)
+    , m_useChunkCache(useChunkCache)
 {
 }
 
@@ -39,6 +39,8 @@ class ConditionNotifier
     ~ConditionNotifier() noexcept = default;
 
     /// @brief If threads are waiting on the condition variable, this call unblocks one of the waiting threads
+    /// @note Notifications of the same index are coalesced, the waiting thread is only woken up when the
+    ///       notification of this index is not already pending
     void notify() noexcept;
 
   protected:
@@ -29,6 +29,16 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief Defines the behavior of the MemoryManager when the best fitting mempool for a requested chunk has no more
+/// free chunks
+enum class MemPoolExhaustedPolicy : uint8_t
+{
+    /// @brief the chunk request fails
+    RETURN_ERROR,
+    /// @brief the chunk is acquired from the next larger mempool which still has free chunks
+    USE_NEXT_LARGER_MEMPOOL
+};
+
 struct MePooConfig
 {
   public:
@@ -46,6 +56,7 @@ struct MePooConfig
 
     using MePooConfigContainerType = cxx::vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    MemPoolExhaustedPolicy m_memPoolExhaustedPolicy{MemPoolExhaustedPolicy::RETURN_ERROR};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() = default;
@@ -58,6 +69,11 @@ struct MePooConfig
     /// @param[in] Entry structure of mempool configuration
     void addMemPool(Entry f_entry) noexcept;
 
+    /// @brief Function for setting the behavior when a mempool has no more free chunks
+    /// @param[in] policy which shall be applied
+    /// @return reference to this MePooConfig
+    MePooConfig& setMemPoolExhaustedPolicy(const MemPoolExhaustedPolicy policy) noexcept;
+
     /// @brief Function for creating default memory pools
     MePooConfig& setDefaults() noexcept;
 
@@ -39,6 +39,12 @@ struct PublisherOptions
 
     /// @brief The option whether the publisher should block when the subscriber queue is full
     SubscriberTooSlowPolicy subscriberTooSlowPolicy{SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA};
+
+    /// @brief The option whether the publisher should claim chunks from the mempools in batches via a per-port cache;
+    /// this reduces the contention when many publishers allocate from the same mempool but keeps up to
+    /// mepoo::MemPoolCache::CAPACITY chunks per mempool reserved for this publisher. Only the allocation is batched,
+    /// the release of a chunk still returns it directly to its mempool
+    bool useChunkCache{false};
 };
 
 } // namespace popo
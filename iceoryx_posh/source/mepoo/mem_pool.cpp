@@ -82,6 +82,7 @@ void* MemPool::getChunk() noexcept
     {
         std::cerr << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
                   << ", used_chunks = " << m_usedChunks << " ] has no more space left" << std::endl;
+        requestCacheFlush();
         return nullptr;
     }
 
@@ -111,6 +112,58 @@ void MemPool::freeChunk(const void* chunk) noexcept
     m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
 }
 
+uint32_t MemPool::getChunkIndices(freeList_t::Index_t* const indices, const uint32_t maxNumberOfIndices) noexcept
+{
+    cxx::Expects(indices != nullptr);
+
+    auto numberOfIndices = m_freeIndices.popBatch(indices, maxNumberOfIndices);
+    if (numberOfIndices > 0U)
+    {
+        m_usedChunks.fetch_add(numberOfIndices, std::memory_order_relaxed);
+        adjustMinFree();
+    }
+    else if (maxNumberOfIndices > 0U)
+    {
+        requestCacheFlush();
+    }
+
+    return numberOfIndices;
+}
+
+void MemPool::freeChunkIndices(const freeList_t::Index_t* const indices, const uint32_t numberOfIndices) noexcept
+{
+    if (numberOfIndices == 0U)
+    {
+        return;
+    }
+
+    cxx::Expects(indices != nullptr);
+
+    auto numberOfPushedIndices = m_freeIndices.pushBatch(indices, numberOfIndices);
+    if (numberOfPushedIndices != numberOfIndices)
+    {
+        errorHandler(Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+
+    m_usedChunks.fetch_sub(numberOfPushedIndices, std::memory_order_relaxed);
+}
+
+void* MemPool::indexToChunk(const freeList_t::Index_t index) const noexcept
+{
+    cxx::Expects(index < m_numberOfChunks);
+    return m_rawMemory + static_cast<uint64_t>(index) * m_chunkSize;
+}
+
+void MemPool::requestCacheFlush() noexcept
+{
+    m_cacheFlushRequestCount.fetch_add(1U, std::memory_order_relaxed);
+}
+
+uint32_t MemPool::getCacheFlushRequestCount() const noexcept
+{
+    return m_cacheFlushRequestCount.load(std::memory_order_relaxed);
+}
+
 uint32_t MemPool::getChunkSize() const noexcept
 {
     return m_chunkSize;
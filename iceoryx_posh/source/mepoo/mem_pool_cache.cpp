@@ -0,0 +1,104 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/mem_pool_cache.hpp"
+#include "iceoryx_hoofs/cxx/algorithm.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t MemPoolCache::CAPACITY;
+constexpr uint32_t MemPoolCache::MEMPOOL_TO_BATCH_SIZE_RATIO;
+
+void* MemPoolCache::getChunk(MemPool& memPool, const uint32_t maxBatchSize) noexcept
+{
+    if (m_memPool.get() != &memPool)
+    {
+        flush();
+        m_memPool = &memPool;
+    }
+
+    if (m_size > 0U && (m_size > maxBatchSize || m_cacheFlushRequestCount != memPool.getCacheFlushRequestCount()))
+    {
+        // either another port ran out of chunks or the cache holds more chunks than currently allowed, therefore only
+        // the chunk for this acquisition is kept
+        --m_size;
+        const auto index = m_indices[m_size];
+        flush();
+        return memPool.indexToChunk(index);
+    }
+
+    if (m_size == 0U)
+    {
+        m_cacheFlushRequestCount = memPool.getCacheFlushRequestCount();
+        const uint32_t numberOfFreeChunks = memPool.getChunkCount() - memPool.getUsedChunks();
+        const uint32_t batchSize = algorithm::max(
+            1U, algorithm::min(maxBatchSize, CAPACITY, numberOfFreeChunks / MEMPOOL_TO_BATCH_SIZE_RATIO));
+        m_size = memPool.getChunkIndices(m_indices, batchSize);
+        if (m_size == 0U)
+        {
+            return nullptr;
+        }
+    }
+
+    --m_size;
+    return memPool.indexToChunk(m_indices[m_size]);
+}
+
+void MemPoolCache::flush() noexcept
+{
+    if (m_size > 0U && m_memPool)
+    {
+        m_memPool->freeChunkIndices(m_indices, m_size);
+    }
+    m_size = 0U;
+}
+
+uint32_t MemPoolCache::size() const noexcept
+{
+    return m_size;
+}
+
+void* ChunkCache::getChunkMemory(const uint32_t memPoolIndex, MemPool& memPool) noexcept
+{
+    return m_chunkMemoryCaches[memPoolIndex].getChunk(memPool);
+}
+
+void* ChunkCache::getChunkManagement(MemPool& chunkManagementPool) noexcept
+{
+    // the chunk management pool has one entry per chunk of all MemPools; if the cache would hold more chunk
+    // managements than chunk memory, the chunk management pool could run empty while chunk memory is available
+    uint32_t numberOfCachedChunkMemory{0U};
+    for (auto& cache : m_chunkMemoryCaches)
+    {
+        numberOfCachedChunkMemory += cache.size();
+    }
+
+    return m_chunkManagementCache.getChunk(chunkManagementPool, numberOfCachedChunkMemory + 1U);
+}
+
+void ChunkCache::flush() noexcept
+{
+    for (auto& cache : m_chunkMemoryCaches)
+    {
+        cache.flush();
+    }
+    m_chunkManagementCache.flush();
+}
+
+} // namespace mepoo
+} // namespace iox
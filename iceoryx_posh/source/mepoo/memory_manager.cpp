@@ -146,10 +146,114 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
         addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
     }
 
+    m_memPoolExhaustedPolicy = mePooConfig.m_memPoolExhaustedPolicy;
+    generateSizeClassIndex();
     generateChunkManagementPool(managementAllocator);
 }
 
+uint32_t MemoryManager::floorLog2(const uint32_t value) noexcept
+{
+    // binary search for the most significant bit; 0 and 1 both result in 0
+    uint32_t result{0U};
+    uint32_t remainder{value};
+    for (uint32_t shift = 16U; shift > 0U; shift /= 2U)
+    {
+        if (remainder >= (1U << shift))
+        {
+            remainder >>= shift;
+            result += shift;
+        }
+    }
+    return result;
+}
+
+uint32_t MemoryManager::sizeClass(const uint32_t size) noexcept
+{
+    // small sizes have their own size class; all others are identified by the most significant bit and the
+    // SUB_CLASS_BITS bits below it
+    if (size < SUB_CLASSES_PER_POWER_OF_TWO)
+    {
+        return size;
+    }
+    const uint32_t mostSignificantBit = floorLog2(size);
+    const uint32_t subClass = (size >> (mostSignificantBit - SUB_CLASS_BITS)) & (SUB_CLASSES_PER_POWER_OF_TWO - 1U);
+    return (mostSignificantBit << SUB_CLASS_BITS) | subClass;
+}
+
+uint64_t MemoryManager::smallestSizeOfSizeClass(const uint32_t sizeClass) noexcept
+{
+    const uint32_t mostSignificantBit = sizeClass >> SUB_CLASS_BITS;
+    if (mostSignificantBit == 0U)
+    {
+        return sizeClass;
+    }
+    // the size classes between the small sizes and the first subdivided power of two are not used
+    if (mostSignificantBit < SUB_CLASS_BITS)
+    {
+        return SUB_CLASSES_PER_POWER_OF_TWO;
+    }
+    const uint64_t subClass = sizeClass & (SUB_CLASSES_PER_POWER_OF_TWO - 1U);
+    return (SUB_CLASSES_PER_POWER_OF_TWO + subClass) << (mostSignificantBit - SUB_CLASS_BITS);
+}
+
+void MemoryManager::generateSizeClassIndex() noexcept
+{
+    // the mempools are ordered by increasing chunk size, therefore the first mempool which is able to hold the
+    // smallest size of a size class is the starting point for the search of all sizes in that size class
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex{0U};
+    for (uint32_t i = 0U; i < NUMBER_OF_SIZE_CLASSES; ++i)
+    {
+        const auto smallestSize = smallestSizeOfSizeClass(i);
+        while (memPoolIndex < numberOfMemPools && m_memPoolVector[memPoolIndex].getChunkSize() < smallestSize)
+        {
+            ++memPoolIndex;
+        }
+        m_sizeClassToMemPoolIndex[i] = static_cast<uint8_t>(memPoolIndex);
+    }
+}
+
+uint32_t MemoryManager::findMemPoolIndex(const uint32_t requiredChunkSize) const noexcept
+{
+    // only the mempools within the size class of the required chunk size need to be skipped
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex = m_sizeClassToMemPoolIndex[sizeClass(requiredChunkSize)];
+    while (memPoolIndex < numberOfMemPools && m_memPoolVector[memPoolIndex].getChunkSize() < requiredChunkSize)
+    {
+        ++memPoolIndex;
+    }
+    return memPoolIndex;
+}
+
+void* MemoryManager::acquireChunk(const uint32_t memPoolIndex, ChunkCache* const chunkCache) noexcept
+{
+    auto& memPool = m_memPoolVector[memPoolIndex];
+    if (chunkCache != nullptr)
+    {
+        return chunkCache->getChunkMemory(memPoolIndex, memPool);
+    }
+    return (m_memPoolExhaustedPolicy == MemPoolExhaustedPolicy::USE_NEXT_LARGER_MEMPOOL)
+               ? acquireSingleChunkQuietly(memPool)
+               : memPool.getChunk();
+}
+
+void* MemoryManager::acquireSingleChunkQuietly(MemPool& memPool) noexcept
+{
+    MemPool::freeList_t::Index_t index{0U};
+    return (memPool.getChunkIndices(&index, 1U) == 1U) ? memPool.indexToChunk(index) : nullptr;
+}
+
 SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+{
+    return getChunkFromMemPool(chunkSettings, nullptr);
+}
+
+SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings, ChunkCache& chunkCache) noexcept
+{
+    return getChunkFromMemPool(chunkSettings, &chunkCache);
+}
+
+SharedChunk MemoryManager::getChunkFromMemPool(const ChunkSettings& chunkSettings, ChunkCache* const chunkCache) noexcept
 {
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
@@ -157,15 +261,28 @@ SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
 
     uint32_t aquiredChunkSize = 0U;
 
-    for (auto& memPool : m_memPoolVector)
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    auto memPoolIndex = findMemPoolIndex(requiredChunkSize);
+    if (memPoolIndex < numberOfMemPools)
     {
-        uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
+        memPoolPointer = &m_memPoolVector[memPoolIndex];
+        aquiredChunkSize = memPoolPointer->getChunkSize();
+        chunk = acquireChunk(memPoolIndex, chunkCache);
+
+        if (m_memPoolExhaustedPolicy == MemPoolExhaustedPolicy::USE_NEXT_LARGER_MEMPOOL)
         {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
-            break;
+            // a spilled chunk is taken directly from the larger mempool; refilling the chunk cache would reserve
+            // chunks of the larger mempool which are only needed while the fitting mempool is exhausted
+            for (++memPoolIndex; chunk == nullptr && memPoolIndex < numberOfMemPools; ++memPoolIndex)
+            {
+                auto& largerMemPool = m_memPoolVector[memPoolIndex];
+                chunk = acquireSingleChunkQuietly(largerMemPool);
+                if (chunk != nullptr)
+                {
+                    memPoolPointer = &largerMemPool;
+                    aquiredChunkSize = largerMemPool.getChunkSize();
+                }
+            }
         }
     }
 
@@ -200,9 +317,22 @@ SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
     }
     else
     {
+        auto& chunkManagementPool = m_chunkManagementPool.front();
+        auto chunkManagementMemory = (chunkCache != nullptr) ? chunkCache->getChunkManagement(chunkManagementPool)
+                                                             : chunkManagementPool.getChunk();
+        if (chunkManagementMemory == nullptr)
+        {
+            memPoolPointer->freeChunk(chunk);
+            LogError() << "MemoryManager: unable to acquire a chunk management for a chunk with a chunk-payload "
+                          "size of "
+                       << chunkSettings.userPayloadSize();
+            errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, nullptr, ErrorLevel::MODERATE);
+            return SharedChunk(nullptr);
+        }
+
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
-            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
+        auto chunkManagement =
+            new (chunkManagementMemory) ChunkManagement(chunkHeader, memPoolPointer, &chunkManagementPool);
         return SharedChunk(chunkManagement);
     }
 }
@@ -41,6 +41,12 @@ void MePooConfig::addMemPool(MePooConfig::Entry f_entry) noexcept
     }
 }
 
+MePooConfig& MePooConfig::setMemPoolExhaustedPolicy(const MemPoolExhaustedPolicy policy) noexcept
+{
+    m_memPoolExhaustedPolicy = policy;
+    return *this;
+}
+
 /// this is the default memory pool configuration if no one is provided by the user
 MePooConfig& MePooConfig::setDefaults() noexcept
 {
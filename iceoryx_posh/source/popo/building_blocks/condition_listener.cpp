@@ -99,9 +99,8 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::f
     {
         for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE; i++)
         {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
+            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed) && reset(i))
             {
-                reset(i);
                 activeNotifications.emplace_back(i);
             }
         }
@@ -116,12 +115,11 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::f
     return activeNotifications;
 }
 
-void ConditionListener::reset(const uint64_t index) noexcept
+bool ConditionListener::reset(const uint64_t index) noexcept
 {
-    if (index < MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE)
-    {
-        getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    }
+    // acquire pairs with the notifier, which only posts the semaphore again after this reset
+    return index < MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE
+           && getMembers()->m_activeNotifications[index].exchange(false, std::memory_order_acq_rel);
 }
 
 const ConditionVariableData* ConditionListener::getMembers() const noexcept
@@ -36,9 +36,12 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    if (m_notificationIndex < MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE)
+    // the semaphore is only posted on the transition to an active notification; while the notification is active
+    // the ConditionListener has not collected it yet and will see it before it waits on the semaphore again
+    if (m_notificationIndex < MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE
+        && getMembers()->m_activeNotifications[m_notificationIndex].exchange(true, std::memory_order_acq_rel))
     {
-        getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+        return;
     }
     getMembers()->m_semaphore.post().or_else([](auto) {
         errorHandler(Error::kPOPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, nullptr, ErrorLevel::FATAL);
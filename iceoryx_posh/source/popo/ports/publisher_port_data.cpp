@@ -27,8 +27,11 @@ PublisherPortData::PublisherPortData(const capro::ServiceDescription& serviceDes
                                      const PublisherOptions& publisherOptions,
                                      const mepoo::MemoryInfo& memoryInfo) noexcept
     : BasePortData(serviceDescription, runtimeName, publisherOptions.nodeName)
-    , m_chunkSenderData(
-          memoryManager, publisherOptions.subscriberTooSlowPolicy, publisherOptions.historyCapacity, memoryInfo)
+    , m_chunkSenderData(memoryManager,
+                        publisherOptions.subscriberTooSlowPolicy,
+                        publisherOptions.historyCapacity,
+                        memoryInfo,
+                        publisherOptions.useChunkCache)
     , m_offeringRequested(publisherOptions.offerOnCreate)
 {
 }
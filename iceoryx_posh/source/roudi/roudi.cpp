@@ -224,7 +224,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     }
     case runtime::IpcMessageType::CREATE_PUBLISHER:
     {
-        if (message.getNumberOfElements() != 8)
+        if (message.getNumberOfElements() != 9)
         {
             LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_PUBLISHER\" from \"" << runtimeName
                        << "\"received!";
@@ -232,7 +232,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             capro::ServiceDescription service(cxx::Serialization(message.getElementAtIndex(2)));
-            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(7));
+            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(8));
 
             if (!service.isValid())
             {
@@ -269,6 +269,15 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             }
             options.subscriberTooSlowPolicy = static_cast<popo::SubscriberTooSlowPolicy>(subscriberTooSlowPolicy);
 
+            uint64_t useChunkCache{};
+            if (!cxx::convert::fromString(message.getElementAtIndex(7).c_str(), useChunkCache))
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_PUBLISHER\"! '"
+                           << message.getElementAtIndex(7).c_str() << "' cannot be extracted from string\n";
+                break;
+            }
+            options.useChunkCache = (0U == useChunkCache) ? false : true;
+
             m_prcMgr->addPublisherForProcess(
                 runtimeName, service, options, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
@@ -130,6 +130,7 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
                << static_cast<cxx::Serialization>(service).toString() << cxx::convert::toString(options.historyCapacity)
                << options.nodeName << cxx::convert::toString(options.offerOnCreate)
                << cxx::convert::toString(static_cast<uint8_t>(options.subscriberTooSlowPolicy))
+               << cxx::convert::toString(options.useChunkCache)
                << static_cast<cxx::Serialization>(portConfigInfo).toString();
 
     auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
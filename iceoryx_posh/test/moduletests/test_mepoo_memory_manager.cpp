@@ -292,6 +292,151 @@ TEST_F(MemoryManager_test, freeChunkSingleMemPoolFullToEmptyToFull)
     EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, CHUNK_COUNT);
 }
 
+TEST_F(MemoryManager_test, getChunkWithChunkCacheAcquiresChunksInBatches)
+{
+    constexpr uint32_t CHUNK_COUNT{100U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache;
+    {
+        auto chunk = sut->getChunk(chunkSettings_128, chunkCache);
+        ASSERT_THAT(chunk, Eq(true));
+        EXPECT_THAT(chunk.getChunkHeader()->userPayloadSize(), Eq(128U));
+        EXPECT_THAT(chunkCache.m_chunkMemoryCaches[0U].size(), Eq(iox::mepoo::MemPoolCache::CAPACITY - 1U));
+        EXPECT_THAT(chunkCache.m_chunkManagementCache.size(), Eq(iox::mepoo::MemPoolCache::CAPACITY - 1U));
+        EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, iox::mepoo::MemPoolCache::CAPACITY);
+    }
+
+    chunkCache.flush();
+
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, 0U);
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkCacheDoesNotReserveMoreChunkManagementsThanChunks)
+{
+    constexpr uint32_t SMALL_CHUNK_COUNT{8U};
+    constexpr uint32_t LARGE_CHUNK_COUNT{16U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, SMALL_CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, LARGE_CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache;
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < SMALL_CHUNK_COUNT - 1U; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32));
+        ASSERT_THAT(chunkStore.back(), Eq(true));
+    }
+    // the mempool has only one chunk left, therefore the chunk management cache must not claim a full batch
+    chunkStore.push_back(sut->getChunk(chunkSettings_32, chunkCache));
+    ASSERT_THAT(chunkStore.back(), Eq(true));
+
+    for (uint32_t i = 0U; i < LARGE_CHUNK_COUNT; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_64));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+    EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, LARGE_CHUNK_COUNT);
+
+    chunkStore.clear();
+    chunkCache.flush();
+
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, 0U);
+    EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, 0U);
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkCacheAlternatingBetweenMemPoolsKeepsTheCachedChunks)
+{
+    constexpr uint32_t CHUNK_COUNT{100U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache;
+    for (uint32_t i = 0U; i < iox::mepoo::MemPoolCache::CAPACITY; ++i)
+    {
+        EXPECT_THAT(sut->getChunk(chunkSettings_32, chunkCache), Eq(true));
+        EXPECT_THAT(sut->getChunk(chunkSettings_128, chunkCache), Eq(true));
+    }
+
+    // every chunk was returned to the mempools, no further batch was claimed
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, 0U);
+    EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, 0U);
+    EXPECT_THAT(chunkCache.m_chunkMemoryCaches[0U].size(), Eq(0U));
+    EXPECT_THAT(chunkCache.m_chunkMemoryCaches[1U].size(), Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkCacheCanAcquireAllChunks)
+{
+    constexpr uint32_t CHUNK_COUNT{20U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache;
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (size_t i = 0U; i < CHUNK_COUNT; i++)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_128, chunkCache));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_EQ(errorLevel, iox::ErrorLevel::MODERATE);
+        });
+
+    EXPECT_THAT(sut->getChunk(chunkSettings_128, chunkCache), Eq(false));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), iox::Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+
+    chunkStore.push_back(sut->getChunk(chunkSettings_32, chunkCache));
+    EXPECT_THAT(chunkStore.back(), Eq(true));
+
+    chunkStore.clear();
+    chunkCache.flush();
+
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, 0U);
+    EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, 0U);
+}
+
+TEST_F(MemoryManager_test, getChunkWithoutChunkCacheSucceedsAfterExhaustedMemPoolWasFlushedByChunkCache)
+{
+    constexpr uint32_t CHUNK_COUNT{100U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache;
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    chunkStore.push_back(sut->getChunk(chunkSettings_128, chunkCache));
+    ASSERT_THAT(chunkStore.back(), Eq(true));
+    ASSERT_THAT(chunkCache.m_chunkMemoryCaches[0U].size(), Gt(0U));
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            detectedError.emplace(error);
+        });
+
+    while (!detectedError.has_value())
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_128));
+    }
+    EXPECT_EQ(detectedError.value(), iox::Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+
+    chunkStore.push_back(sut->getChunk(chunkSettings_128, chunkCache));
+    ASSERT_THAT(chunkStore.back(), Eq(true));
+    EXPECT_THAT(chunkCache.m_chunkMemoryCaches[0U].size(), Eq(0U));
+    EXPECT_THAT(chunkCache.m_chunkManagementCache.size(), Eq(0U));
+
+    detectedError.reset();
+    EXPECT_THAT(sut->getChunk(chunkSettings_128), Eq(true));
+    EXPECT_FALSE(detectedError.has_value());
+}
+
 TEST_F(MemoryManager_test, getChunkMultiMemPoolSingleChunk)
 {
     constexpr uint32_t CHUNK_COUNT{10U};
@@ -397,6 +542,129 @@ TEST_F(MemoryManager_test, emptyMemPoolDoesNotResultInAcquiringChunksFromOtherMe
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
 }
 
+TEST_F(MemoryManager_test, emptyMemPoolWithUseNextLargerMemPoolPolicyResultsInAcquiringChunksFromLargerMemPools)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    mempoolconf.setMemPoolExhaustedPolicy(iox::mepoo::MemPoolExhaustedPolicy::USE_NEXT_LARGER_MEMPOOL);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (size_t i = 0; i < 3U * CHUNK_COUNT; i++)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_64));
+        ASSERT_THAT(chunkStore.back(), Eq(true));
+        EXPECT_THAT(chunkStore.back().getChunkHeader()->userPayloadSize(), Eq(CHUNK_SIZE_64));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(CHUNK_COUNT));
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_EQ(errorLevel, iox::ErrorLevel::MODERATE);
+        });
+
+    EXPECT_THAT(sut->getChunk(chunkSettings_64), Eq(false));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), iox::Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+
+    chunkStore.clear();
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkAcquiresChunkFromSmallestFittingMemPoolWithinTheSameSizeClass)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({40U, CHUNK_COUNT});
+    mempoolconf.addMemPool({48U, CHUNK_COUNT});
+    mempoolconf.addMemPool({56U, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    for (uint32_t userPayloadSize = 1U; userPayloadSize <= CHUNK_SIZE_64; ++userPayloadSize)
+    {
+        auto chunkSettingsResult = ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+        auto chunk = sut->getChunk(chunkSettingsResult.value());
+        ASSERT_THAT(chunk, Eq(true));
+
+        const uint32_t expectedUserPayloadCapacity = ((userPayloadSize + 7U) / 8U) * 8U;
+        const uint32_t minimalUserPayloadCapacity{CHUNK_SIZE_32};
+        const uint32_t expectedChunkSize = std::max(expectedUserPayloadCapacity, minimalUserPayloadCapacity)
+                                           + static_cast<uint32_t>(sizeof(ChunkHeader));
+        EXPECT_THAT(chunk.getChunkHeader()->chunkSize(), Eq(expectedChunkSize));
+    }
+}
+
+TEST_F(MemoryManager_test, getChunkAcquiresChunkFromSmallestFittingMemPoolWithManyMemPoolsWithinOnePowerOfTwo)
+{
+    constexpr uint32_t CHUNK_COUNT{1U};
+    constexpr uint32_t NUMBER_OF_MEMPOOLS{16U};
+    constexpr uint32_t SMALLEST_USER_PAYLOAD_SIZE{4096U};
+    constexpr uint32_t USER_PAYLOAD_SIZE_STEP{256U};
+
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        mempoolconf.addMemPool({SMALLEST_USER_PAYLOAD_SIZE + i * USER_PAYLOAD_SIZE_STEP, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        const uint32_t userPayloadCapacity = SMALLEST_USER_PAYLOAD_SIZE + i * USER_PAYLOAD_SIZE_STEP;
+        auto chunkSettingsResult =
+            ChunkSettings::create(userPayloadCapacity - 7U, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+        auto chunk = sut->getChunk(chunkSettingsResult.value());
+        ASSERT_THAT(chunk, Eq(true));
+        EXPECT_THAT(chunk.getChunkHeader()->chunkSize(),
+                    Eq(userPayloadCapacity + static_cast<uint32_t>(sizeof(ChunkHeader))));
+    }
+}
+
+TEST_F(MemoryManager_test, spillingToLargerMemPoolWithChunkCacheAcquiresOnlyASingleChunk)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.setMemPoolExhaustedPolicy(iox::mepoo::MemPoolExhaustedPolicy::USE_NEXT_LARGER_MEMPOOL);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache;
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32, chunkCache));
+        ASSERT_THAT(chunkStore.back(), Eq(true));
+    }
+    EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, 0U);
+
+    chunkStore.push_back(sut->getChunk(chunkSettings_32, chunkCache));
+    ASSERT_THAT(chunkStore.back(), Eq(true));
+    EXPECT_THAT(chunkStore.back().getChunkHeader()->chunkSize(),
+                Eq(CHUNK_SIZE_64 + static_cast<uint32_t>(sizeof(ChunkHeader))));
+    EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, 1U);
+    EXPECT_THAT(chunkCache.m_chunkMemoryCaches[1U].size(), Eq(0U));
+
+    chunkStore.clear();
+    chunkCache.flush();
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, 0U);
+    EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, 0U);
+}
+
 TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
 {
     constexpr uint32_t CHUNK_COUNT{100U};
@@ -196,6 +196,65 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, GetChunkIndicesAcquiresRequestedNumberOfChunksAndAdjustsCounters)
+{
+    constexpr uint32_t NUMBER_OF_INDICES{8U};
+    FreeListIndex_t indices[NUMBER_OF_INDICES];
+
+    EXPECT_THAT(sut.getChunkIndices(indices, NUMBER_OF_INDICES), Eq(NUMBER_OF_INDICES));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_INDICES));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_INDICES));
+    for (auto index : indices)
+    {
+        EXPECT_THAT(sut.indexToChunk(index), Eq(m_rawMemory + index * CHUNK_SIZE));
+    }
+}
+
+TEST_F(MemPool_test, GetChunkIndicesWhenMemPoolRunsEmptyReturnsRemainingChunks)
+{
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS - 3U; ++i)
+    {
+        ASSERT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+
+    FreeListIndex_t indices[8U];
+    EXPECT_THAT(sut.getChunkIndices(indices, 8U), Eq(3U));
+    EXPECT_THAT(sut.getChunkIndices(indices, 8U), Eq(0U));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(MemPool_test, FreeChunkIndicesReturnsChunksToTheMemPool)
+{
+    FreeListIndex_t indices[NUMBER_OF_CHUNKS];
+    ASSERT_THAT(sut.getChunkIndices(indices, NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+
+    sut.freeChunkIndices(indices, NUMBER_OF_CHUNKS);
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getMinFree(), Eq(0U));
+    EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+}
+
+TEST_F(MemPool_test, FreeChunkIndicesWithAlreadyFreedChunkReturnsError)
+{
+    FreeListIndex_t indices[2U];
+    ASSERT_THAT(sut.getChunkIndices(indices, 2U), Eq(2U));
+    sut.freeChunk(sut.indexToChunk(indices[0U]));
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::FATAL));
+        });
+
+    sut.freeChunkIndices(indices, 2U);
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     EXPECT_DEATH({ iox::mepoo::MemPool sut(12, 10, allocator, allocator); }, ".*");
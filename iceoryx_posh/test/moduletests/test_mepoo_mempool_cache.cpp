@@ -0,0 +1,174 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool_cache.hpp"
+#include "test.hpp"
+
+#include <set>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class MemPoolCache_test : public Test
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_CHUNKS{MemPoolCache::CAPACITY * MemPoolCache::MEMPOOL_TO_BATCH_SIZE_RATIO};
+    static constexpr uint32_t CHUNK_SIZE{64U};
+    static constexpr uint32_t MEMORY_SIZE{2U * NUMBER_OF_CHUNKS * CHUNK_SIZE + 10000U};
+
+    alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t m_rawMemory[MEMORY_SIZE];
+    iox::posix::Allocator allocator{m_rawMemory, MEMORY_SIZE};
+
+    MemPool memPool{CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator};
+    MemPool otherMemPool{CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator};
+
+    MemPoolCache sut;
+};
+
+TEST_F(MemPoolCache_test, InitialCacheIsEmpty)
+{
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
+TEST_F(MemPoolCache_test, GetChunkRefillsTheCacheWithABatchOfChunks)
+{
+    EXPECT_THAT(sut.getChunk(memPool), Ne(nullptr));
+
+    EXPECT_THAT(sut.size(), Eq(MemPoolCache::CAPACITY - 1U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(MemPoolCache::CAPACITY));
+}
+
+TEST_F(MemPoolCache_test, GetChunkReturnsEveryChunkOfTheMemPoolExactlyOnce)
+{
+    std::set<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto chunk = sut.getChunk(memPool);
+        ASSERT_THAT(chunk, Ne(nullptr));
+        EXPECT_TRUE(chunks.insert(chunk).second);
+    }
+
+    EXPECT_THAT(sut.getChunk(memPool), Eq(nullptr));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(MemPoolCache_test, FlushReturnsCachedChunksToTheMemPool)
+{
+    auto chunk = sut.getChunk(memPool);
+    ASSERT_THAT(chunk, Ne(nullptr));
+
+    sut.flush();
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(1U));
+
+    memPool.freeChunk(chunk);
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(MemPoolCache_test, GetChunkFromOtherMemPoolReturnsCachedChunksToThePreviousMemPool)
+{
+    ASSERT_THAT(sut.getChunk(memPool), Ne(nullptr));
+
+    EXPECT_THAT(sut.getChunk(otherMemPool), Ne(nullptr));
+
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(1U));
+    EXPECT_THAT(otherMemPool.getUsedChunks(), Eq(MemPoolCache::CAPACITY));
+}
+
+TEST_F(MemPoolCache_test, GetChunkFromSmallMemPoolLimitsTheBatchSize)
+{
+    constexpr uint32_t SMALL_NUMBER_OF_CHUNKS{4U};
+    MemPool smallMemPool{CHUNK_SIZE, SMALL_NUMBER_OF_CHUNKS, allocator, allocator};
+
+    EXPECT_THAT(sut.getChunk(smallMemPool), Ne(nullptr));
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(smallMemPool.getUsedChunks(), Eq(1U));
+}
+
+TEST_F(MemPoolCache_test, GetChunkWithMaxBatchSizeLimitsTheBatchSize)
+{
+    constexpr uint32_t MAX_BATCH_SIZE{3U};
+    EXPECT_THAT(sut.getChunk(memPool, MAX_BATCH_SIZE), Ne(nullptr));
+
+    EXPECT_THAT(sut.size(), Eq(MAX_BATCH_SIZE - 1U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(MAX_BATCH_SIZE));
+}
+
+TEST_F(MemPoolCache_test, GetChunkFromMemPoolWithFewFreeChunksLimitsTheBatchSize)
+{
+    constexpr uint32_t NUMBER_OF_FREE_CHUNKS{2U * MemPoolCache::MEMPOOL_TO_BATCH_SIZE_RATIO};
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS - NUMBER_OF_FREE_CHUNKS; ++i)
+    {
+        ASSERT_THAT(memPool.getChunk(), Ne(nullptr));
+    }
+
+    EXPECT_THAT(sut.getChunk(memPool), Ne(nullptr));
+
+    EXPECT_THAT(sut.size(), Eq(NUMBER_OF_FREE_CHUNKS / MemPoolCache::MEMPOOL_TO_BATCH_SIZE_RATIO - 1U));
+}
+
+TEST_F(MemPoolCache_test, GetChunkAfterTheMemPoolWasExhaustedReturnsTheCachedChunks)
+{
+    ASSERT_THAT(sut.getChunk(memPool), Ne(nullptr));
+    ASSERT_THAT(sut.size(), Gt(0U));
+    const uint32_t numberOfCachedChunks = sut.size();
+
+    while (memPool.getChunk() != nullptr)
+    {
+    }
+
+    EXPECT_THAT(sut.getChunk(memPool), Ne(nullptr));
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(NUMBER_OF_CHUNKS - (numberOfCachedChunks - 1U)));
+}
+
+TEST_F(MemPoolCache_test, CachesOfManyPortsDoNotStrandTheChunksOfAnExhaustedMemPool)
+{
+    constexpr uint32_t NUMBER_OF_CACHES{8U};
+    MemPoolCache caches[NUMBER_OF_CACHES];
+    for (auto& cache : caches)
+    {
+        ASSERT_THAT(cache.getChunk(memPool), Ne(nullptr));
+    }
+
+    uint32_t numberOfChunksOfPortWithoutCache{0U};
+    while (memPool.getChunk() != nullptr)
+    {
+        ++numberOfChunksOfPortWithoutCache;
+    }
+
+    // every port with a cache acquires another chunk and returns its surplus chunks
+    for (auto& cache : caches)
+    {
+        ASSERT_THAT(cache.getChunk(memPool), Ne(nullptr));
+        EXPECT_THAT(cache.size(), Eq(0U));
+    }
+
+    while (memPool.getChunk() != nullptr)
+    {
+        ++numberOfChunksOfPortWithoutCache;
+    }
+
+    EXPECT_THAT(numberOfChunksOfPortWithoutCache, Eq(NUMBER_OF_CHUNKS - 2U * NUMBER_OF_CACHES));
+}
+
+} // namespace
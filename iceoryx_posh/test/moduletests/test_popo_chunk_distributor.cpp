@@ -108,7 +108,34 @@ class ChunkDistributor_test : public Test
     std::shared_ptr<ChunkDistributorData_t>
     getChunkDistributorData(const SubscriberTooSlowPolicy policy = SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA)
     {
-        return std::make_shared<ChunkDistributorData_t>(policy, HISTORY_SIZE);
+        return getChunkDistributorDataWithHistory(HISTORY_SIZE, policy);
+    }
+
+    std::shared_ptr<ChunkDistributorData_t> getChunkDistributorDataWithHistory(
+        const uint64_t historyCapacity,
+        const SubscriberTooSlowPolicy policy = SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA)
+    {
+        return std::make_shared<ChunkDistributorData_t>(policy, historyCapacity);
+    }
+
+    /// @brief leaves the history lock and the reader registrations behind like a sender which is stuck or was
+    /// terminated while delivering a chunk
+    void simulateSenderInsideTheDistributor(ChunkDistributorData_t& chunkDistributorData)
+    {
+        chunkDistributorData.m_historyLockOwner.store(ChunkDistributorData_t::HistoryLockOwner::SENDER);
+        for (auto& readerCount : chunkDistributorData.m_queuesReaderCount)
+        {
+            readerCount.store(1U);
+        }
+    }
+
+    void simulateSenderLeavingTheDistributor(ChunkDistributorData_t& chunkDistributorData)
+    {
+        chunkDistributorData.m_historyLockOwner.store(ChunkDistributorData_t::HistoryLockOwner::NONE);
+        for (auto& readerCount : chunkDistributorData.m_queuesReaderCount)
+        {
+            readerCount.store(0U);
+        }
     }
 
     static constexpr int64_t TIMEOUT_IN_MS = 100;
@@ -647,4 +674,212 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, RemovingQueueWhileDeliveryIsBlockedByThisQueueDoesNotBlock)
+{
+    auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    auto threadSyncSemaphore = iox::posix::Semaphore::create(iox::posix::CreateUnnamedSingleProcessSemaphore, 0U);
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        ASSERT_FALSE(threadSyncSemaphore->post().has_error());
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+        wasChunkDelivered = true;
+    });
+
+    ASSERT_FALSE(threadSyncSemaphore->wait().has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT_IN_MS));
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(155U));
+    EXPECT_THAT(queue.tryPop().has_value(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, CleanupAfterSenderTerminatedInsideTheDistributorDoesNotCallErrorHandler)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(7U));
+
+    this->simulateSenderInsideTheDistributor(*sutData);
+
+    bool errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&errorHandlerCalled](const iox::Error, const std::function<void()>, const iox::ErrorLevel) {
+            errorHandlerCalled = true;
+        });
+
+    sut.cleanup();
+
+    EXPECT_FALSE(errorHandlerCalled);
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+    sut.removeAllQueues();
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingQueueWaitsForSlowSenderWithoutDiscardingIt)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    this->simulateSenderInsideTheDistributor(*sutData);
+
+    std::atomic_bool isQueueRemoved{false};
+    std::thread modifier([&] {
+        EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+        isQueueRemoved = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT_IN_MS));
+    EXPECT_FALSE(isQueueRemoved.load());
+    for (const auto& readerCount : sutData->m_queuesReaderCount)
+    {
+        EXPECT_THAT(readerCount.load(), Eq(1U));
+    }
+
+    this->simulateSenderLeavingTheDistributor(*sutData);
+    modifier.join();
+    EXPECT_TRUE(isQueueRemoved.load());
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, AddingAndRemovingQueuesAfterSenderTerminatedInsideTheDistributorCompletesAfterCleanup)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(7U));
+
+    this->simulateSenderInsideTheDistributor(*sutData);
+
+    // the discovery is blocked until RouDi removes the ports of the terminated application from another context
+    auto newQueueData = this->getChunkQueueData();
+    std::atomic_bool isDiscoveryFinished{false};
+    std::thread discovery([&] {
+        EXPECT_FALSE(sut.tryAddQueue(newQueueData.get(), 1U).has_error());
+        EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+        isDiscoveryFinished = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT_IN_MS));
+    EXPECT_FALSE(isDiscoveryFinished.load());
+
+    sut.cleanup();
+    discovery.join();
+    EXPECT_TRUE(isDiscoveryFinished.load());
+
+    sut.removeAllQueues();
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, ChunkSentWhileQueueIsAddedIsDeliveredExactlyOnce)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 8U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueDatas;
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueDatas.emplace_back(this->getChunkQueueData());
+    }
+
+    std::thread sender([&] {
+        for (uint32_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+        {
+            sut.deliverToAllStoredQueues(this->allocateChunk(i));
+        }
+    });
+    for (auto& queueData : queueDatas)
+    {
+        ASSERT_FALSE(sut.tryAddQueue(queueData.get(), this->HISTORY_SIZE).has_error());
+    }
+    sender.join();
+
+    for (auto& queueData : queueDatas)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+        std::vector<uint32_t> receivedValues;
+        while (auto maybeSharedChunk = queue.tryPop())
+        {
+            receivedValues.emplace_back(this->getSharedChunkValue(*maybeSharedChunk));
+        }
+
+        ASSERT_THAT(receivedValues.size(), Eq(NUMBER_OF_QUEUES));
+        for (uint32_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+        {
+            EXPECT_THAT(receivedValues[i], Eq(i));
+        }
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, ChunkSentWhileQueueIsAddedWithoutHistoryIsDeliveredExactlyOnce)
+{
+    auto sutData = this->getChunkDistributorDataWithHistory(0U);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 8U;
+    constexpr uint32_t NUMBER_OF_CHUNKS = 16U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueDatas;
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueDatas.emplace_back(this->getChunkQueueData());
+    }
+
+    std::thread sender([&] {
+        for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            sut.deliverToAllStoredQueues(this->allocateChunk(i));
+        }
+    });
+    for (auto& queueData : queueDatas)
+    {
+        ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    }
+    sender.join();
+    sut.deliverToAllStoredQueues(this->allocateChunk(NUMBER_OF_CHUNKS));
+
+    // without a history a queue misses the chunks sent before it was added but must receive every chunk afterwards
+    for (auto& queueData : queueDatas)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+        std::vector<uint32_t> receivedValues;
+        while (auto maybeSharedChunk = queue.tryPop())
+        {
+            receivedValues.emplace_back(this->getSharedChunkValue(*maybeSharedChunk));
+        }
+
+        ASSERT_FALSE(receivedValues.empty());
+        EXPECT_THAT(receivedValues.back(), Eq(NUMBER_OF_CHUNKS));
+        for (uint64_t i = 1U; i < receivedValues.size(); ++i)
+        {
+            EXPECT_THAT(receivedValues[i], Eq(receivedValues[i - 1U] + 1U));
+        }
+    }
+}
+
 } // namespace
@@ -28,6 +28,9 @@
 
 #include "test.hpp"
 
+#include <atomic>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -237,6 +240,86 @@ TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
     EXPECT_THAT(condVarWaiter2.timedWait(1_ms).empty(), Eq(false));
 }
 
+TYPED_TEST(ChunkQueue_test, PushAfterUnsetConditionVariableDoesNotNotify)
+{
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariable(condVar, 0U);
+    this->m_popper.unsetConditionVariable();
+    EXPECT_THAT(this->m_popper.isConditionVariableSet(), Eq(false));
+
+    auto chunk = this->allocateChunk();
+    this->m_pusher.push(chunk);
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ms).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, BurstOfPushesPostsTheSemaphoreOnlyOnce)
+{
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    for (uint32_t i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        auto chunk = this->allocateChunk();
+        this->m_pusher.push(chunk);
+    }
+
+    EXPECT_THAT(condVar.m_semaphore.getValue().value(), Eq(1));
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+}
+
+TYPED_TEST(ChunkQueue_test, PushDuringUnfinishedConditionVariableAttachmentNeitherBlocksNorNotifies)
+{
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    // a subscriber which terminates while it attaches the condition variable leaves an odd sequence number behind
+    this->m_chunkData.m_conditionVariableSequenceNumber.fetch_add(1U);
+
+    auto chunk = this->allocateChunk();
+    EXPECT_TRUE(this->m_pusher.push(chunk));
+    EXPECT_THAT(condVarWaiter.timedWait(1_ms).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, ConcurrentPushWhileSettingAndUnsettingConditionVariableNotifiesTheLastOne)
+{
+    ConditionVariableData condVar1("Horscht");
+    ConditionVariableData condVar2("Schnuppi");
+    ConditionListener condVarWaiter2{condVar2};
+
+    std::atomic_bool keepPushing{true};
+    std::thread pusher([&] {
+        while (keepPushing.load())
+        {
+            this->m_pusher.push(this->allocateChunk());
+            IOX_DISCARD_RESULT(this->m_popper.tryPop());
+        }
+    });
+
+    constexpr uint64_t NUMBER_OF_ITERATIONS{10000U};
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        this->m_popper.setConditionVariable(condVar1, i % iox::MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE);
+        this->m_popper.setConditionVariable(condVar2, 1U);
+        this->m_popper.unsetConditionVariable();
+    }
+    this->m_popper.setConditionVariable(condVar2, 1U);
+    keepPushing = false;
+    pusher.join();
+
+    // a notification after the last setConditionVariable must use the last condition variable and index
+    condVarWaiter2.timedWait(1_ns);
+    this->m_pusher.push(this->allocateChunk());
+    auto notifications = condVarWaiter2.timedWait(1_ms);
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0], Eq(1U));
+}
+
 /// @note this could be changed to a parameterized ChunkQueueSaturatingFIFO_test when there are more FIFOs available
 using ChunkQueueFiFoTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 /// we require TYPED_TEST since we support gtest 1.8 for our safety targets
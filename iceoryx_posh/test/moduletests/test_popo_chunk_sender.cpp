@@ -110,8 +110,15 @@ class ChunkSender_test : public Test
     ChunkSenderData_t m_chunkSenderDataWithHistory{
         &m_memoryManager, iox::popo::SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA, HISTORY_CAPACITY};
 
+    ChunkSenderData_t m_chunkSenderDataWithChunkCache{&m_memoryManager,
+                                                      iox::popo::SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                                      0,
+                                                      iox::mepoo::MemoryInfo(),
+                                                      true};
+
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSender{&m_chunkSenderData};
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithHistory{&m_chunkSenderDataWithHistory};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithChunkCache{&m_chunkSenderDataWithChunkCache};
 };
 
 TEST_F(ChunkSender_test, allocate_OneChunkWithoutUserHeaderAndSmallUserPayloadAlignmentResultsInSmallChunk)
@@ -631,4 +638,34 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, allocateWithChunkCacheReservesChunksInTheMemPool)
+{
+    auto maybeChunkHeader = m_chunkSenderWithChunkCache.tryAllocate(
+        iox::UniquePortId(), SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->userPayloadSize(), Eq(SMALL_CHUNK));
+
+    // the batch size is limited by the size of the mempool
+    constexpr uint32_t EXPECTED_BATCH_SIZE{NUM_CHUNKS_IN_POOL / iox::mepoo::MemPoolCache::MEMPOOL_TO_BATCH_SIZE_RATIO};
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(EXPECTED_BATCH_SIZE));
+    EXPECT_THAT(m_chunkSenderDataWithChunkCache.m_chunkCache.m_chunkMemoryCaches[0U].size(),
+                Eq(EXPECTED_BATCH_SIZE - 1U));
+}
+
+TEST_F(ChunkSender_test, CleanupWithChunkCacheReturnsCachedChunksToTheMemPool)
+{
+    for (size_t i = 0; i < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY; i++)
+    {
+        auto maybeChunkHeader = m_chunkSenderWithChunkCache.tryAllocate(
+            iox::UniquePortId(), SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        EXPECT_FALSE(maybeChunkHeader.has_error());
+    }
+
+    m_chunkSenderWithChunkCache.releaseAll();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_chunkSenderDataWithChunkCache.m_chunkCache.m_chunkMemoryCaches[0U].size(), Eq(0U));
+    EXPECT_THAT(m_chunkSenderDataWithChunkCache.m_chunkCache.m_chunkManagementCache.size(), Eq(0U));
+}
+
 } // namespace
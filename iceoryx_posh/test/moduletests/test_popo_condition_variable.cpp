@@ -109,6 +109,23 @@ TEST_F(ConditionVariable_test, WaitResetsAllNotificationsInWait)
     EXPECT_TRUE(isThreadFinished.load());
 }
 
+TEST_F(ConditionVariable_test, RepeatedNotifyOfPendingNotificationPostsSemaphoreOnlyOnce)
+{
+    constexpr uint64_t NUMBER_OF_NOTIFICATIONS{1000U};
+    for (uint64_t i = 0U; i < NUMBER_OF_NOTIFICATIONS; ++i)
+    {
+        m_signaler.notify();
+    }
+    EXPECT_THAT(m_condVarData.m_semaphore.getValue().value(), Eq(1));
+
+    auto activeNotifications = m_waiter.wait();
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0], Eq(0U));
+
+    m_signaler.notify();
+    EXPECT_THAT(m_condVarData.m_semaphore.getValue().value(), Eq(1));
+}
+
 TEST_F(ConditionVariable_test, WaitAndNotifyResultsInImmediateTriggerMultiThreaded)
 {
     std::atomic<int> counter{0};
@@ -0,0 +1,229 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::mepoo;
+using namespace iox::units::duration_literals;
+
+constexpr int64_t STRESS_TIME_HOURS{0};
+constexpr int64_t STRESS_TIME_MINUTES{0};
+constexpr int64_t STRESS_TIME_SECONDS{2};
+constexpr std::chrono::milliseconds STRESS_TIME{
+    ((STRESS_TIME_HOURS * 60 + STRESS_TIME_MINUTES) * 60 + STRESS_TIME_SECONDS) * 1000};
+
+constexpr uint64_t BURST_SIZE{1000U};
+constexpr uint64_t NUMBER_OF_BURSTS{1000U};
+
+class ChunkQueueNotificationStress : public Test
+{
+  public:
+    using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, ThreadSafePolicy>;
+
+    void SetUp() override
+    {
+        // the chunks are released by the queue in DISCARD_OLDEST_DATA mode, therefore one chunk is reused for
+        // every push and the measurement is not dominated by the mempool
+        m_chunk = allocateChunk();
+        ASSERT_TRUE(m_chunk);
+    }
+
+    SharedChunk allocateChunk()
+    {
+        ChunkManagement* chunkMgmt = static_cast<ChunkManagement*>(m_chunkMgmtPool.getChunk());
+        auto chunk = m_mempool.getChunk();
+
+        auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        if (chunkSettingsResult.has_error())
+        {
+            return nullptr;
+        }
+
+        ChunkHeader* chunkHeader = new (chunk) ChunkHeader(m_mempool.getChunkSize(), chunkSettingsResult.value());
+        new (chunkMgmt) ChunkManagement{chunkHeader, &m_mempool, &m_chunkMgmtPool};
+        return SharedChunk(chunkMgmt);
+    }
+
+    /// @brief emulates the notification of a push before the notifications were coalesced, i.e. the queue lock
+    ///        is taken and the semaphore is posted for every single push
+    void pushWithNotificationForEveryChunk(ChunkQueuePusher<ChunkQueueData_t>& pusher,
+                                           ConditionVariableData& condVar,
+                                           const uint64_t notificationIndex)
+    {
+        pusher.push(m_chunk);
+        typename ChunkQueueData_t::LockGuard_t lock(m_chunkQueueData);
+        condVar.m_activeNotifications[notificationIndex].store(true, std::memory_order_release);
+        IOX_DISCARD_RESULT(condVar.m_semaphore.post());
+    }
+
+    static constexpr uint32_t USER_PAYLOAD_SIZE{128U};
+    static constexpr size_t MEGABYTE = 1U << 20U;
+    static constexpr size_t MEMORY_SIZE = 4U * MEGABYTE;
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+    iox::posix::Allocator m_allocator{m_memory.get(), MEMORY_SIZE};
+    MemPool m_mempool{sizeof(ChunkHeader) + USER_PAYLOAD_SIZE,
+                      2U * iox::MAX_SUBSCRIBER_QUEUE_CAPACITY,
+                      m_allocator,
+                      m_allocator};
+    MemPool m_chunkMgmtPool{128U, 2U * iox::MAX_SUBSCRIBER_QUEUE_CAPACITY, m_allocator, m_allocator};
+
+    ChunkQueueData_t m_chunkQueueData{QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                      iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer};
+    ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkQueueData};
+    ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkQueueData};
+    SharedChunk m_chunk;
+};
+
+/// @brief A publisher sends bursts to a subscriber which is attached to a WaitSet. Every burst must result in a
+///        single wake-up of the WaitSet and is compared to the previous behavior with a wake-up per chunk.
+TEST_F(ChunkQueueNotificationStress, BurstOfPushesIsFasterWithCoalescedNotifications)
+{
+    constexpr uint64_t NOTIFICATION_INDEX{0U};
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    m_popper.setConditionVariable(condVar, NOTIFICATION_INDEX);
+
+    auto measure = [&](auto pushOne) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t burst = 0U; burst < NUMBER_OF_BURSTS; ++burst)
+        {
+            for (uint64_t i = 0U; i < BURST_SIZE; ++i)
+            {
+                pushOne();
+            }
+            EXPECT_THAT(condVarWaiter.timedWait(1_ms).size(), Eq(1U));
+            while (m_popper.tryPop().has_value())
+            {
+            }
+            // remove the tokens which are left over from the uncoalesced notifications
+            while (condVar.m_semaphore.tryWait().value())
+            {
+            }
+        }
+        auto duration = std::chrono::steady_clock::now() - start;
+        return static_cast<double>(NUMBER_OF_BURSTS * BURST_SIZE)
+               / std::chrono::duration_cast<std::chrono::duration<double>>(duration).count();
+    };
+
+    const double pushesPerSecondCoalesced = measure([&] { m_pusher.push(m_chunk); });
+    const double pushesPerSecondUncoalesced =
+        measure([&] { pushWithNotificationForEveryChunk(m_pusher, condVar, NOTIFICATION_INDEX); });
+
+    std::cout << "burst size " << BURST_SIZE << ": " << static_cast<uint64_t>(pushesPerSecondCoalesced)
+              << " pushes/s with coalesced notifications, " << static_cast<uint64_t>(pushesPerSecondUncoalesced)
+              << " pushes/s with a notification per push" << std::endl;
+
+    EXPECT_THAT(pushesPerSecondCoalesced, Gt(pushesPerSecondUncoalesced));
+}
+
+/// @brief The subscriber is attached to and detached from WaitSets while the publisher keeps on pushing without
+///        taking the queue lock. The listener must only see notifications of the index which is attached to it and
+///        a push after the final attachment must always wake it up.
+TEST_F(ChunkQueueNotificationStress, PushWhileAttachingAndDetachingConditionVariables)
+{
+    constexpr uint64_t NOTIFICATION_INDEX_1{3U};
+    constexpr uint64_t NOTIFICATION_INDEX_2{7U};
+    ConditionVariableData condVar1("Horscht");
+    ConditionVariableData condVar2("Schnuppi");
+    ConditionListener condVarWaiter1{condVar1};
+    ConditionListener condVarWaiter2{condVar2};
+
+    std::atomic_bool keepRunning{true};
+    std::atomic<uint64_t> numberOfWrongNotifications{0U};
+    std::atomic<uint64_t> numberOfPushes{0U};
+
+    std::thread pusher([&] {
+        while (keepRunning.load(std::memory_order_relaxed))
+        {
+            m_pusher.push(m_chunk);
+            numberOfPushes.fetch_add(1U, std::memory_order_relaxed);
+        }
+    });
+
+    auto listen = [&](ConditionListener& listener, const uint64_t expectedIndex) {
+        return std::thread([&, expectedIndex] {
+            while (keepRunning.load(std::memory_order_relaxed))
+            {
+                for (auto index : listener.timedWait(1_ms))
+                {
+                    if (index != expectedIndex)
+                    {
+                        numberOfWrongNotifications.fetch_add(1U, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+    };
+    std::thread listener1 = listen(condVarWaiter1, NOTIFICATION_INDEX_1);
+    std::thread listener2 = listen(condVarWaiter2, NOTIFICATION_INDEX_2);
+
+    uint64_t numberOfAttachments{0U};
+    auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < STRESS_TIME)
+    {
+        m_popper.setConditionVariable(condVar1, NOTIFICATION_INDEX_1);
+        m_popper.setConditionVariable(condVar2, NOTIFICATION_INDEX_2);
+        m_popper.unsetConditionVariable();
+        while (m_popper.tryPop().has_value())
+        {
+        }
+        ++numberOfAttachments;
+    }
+
+    m_popper.setConditionVariable(condVar1, NOTIFICATION_INDEX_1);
+    keepRunning = false;
+    pusher.join();
+    listener1.join();
+    listener2.join();
+
+    IOX_DISCARD_RESULT(condVarWaiter1.timedWait(1_ns));
+    m_pusher.push(m_chunk);
+    auto notifications = condVarWaiter1.timedWait(1_s);
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0], Eq(NOTIFICATION_INDEX_1));
+
+    std::cout << numberOfPushes.load() << " pushes during " << numberOfAttachments << " attachment cycles"
+              << std::endl;
+    EXPECT_THAT(numberOfWrongNotifications.load(), Eq(0U));
+    EXPECT_THAT(numberOfPushes.load(), Gt(0U));
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}